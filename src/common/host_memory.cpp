@@ -21,6 +21,24 @@
 #include <unistd.h>
 #include "common/scope_exit.h"
 
+#ifdef __linux__
+#include <linux/userfaultfd.h>
+#endif
+#if defined(UFFDIO_WRITEPROTECT) && defined(UFFD_FEATURE_WP_HUGETLBFS_SHMEM)
+#define HAS_USERFAULTFD_WP 1
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
+#include <boost/icl/interval_map.hpp>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include "common/thread.h"
+#endif
+
 #ifndef MAP_NORESERVE
 #define MAP_NORESERVE 0
 #endif
@@ -89,7 +107,7 @@ static void GetFuncAddress(Common::DynamicLibrary& dll, const char* name, T& pfn
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
+    explicit Impl(size_t backing_size_, size_t virtual_size_, bool /* use_huge_pages */)
         : backing_size{backing_size_}, virtual_size{virtual_size_}, process{GetCurrentProcess()},
           kernelbase_dll("Kernelbase") {
         if (!kernelbase_dll.IsOpen()) {
@@ -189,11 +207,25 @@ public:
         }
     }
 
+    bool SetWriteFaultHandler(WriteFaultHandler&& handler) {
+        return false;
+    }
+
     bool ClearBackingRegion(size_t physical_offset, size_t length) {
         // TODO: This does not seem to be possible on Windows.
         return false;
     }
 
+    bool BeginSnapshot() {
+        return false;
+    }
+
+    bool ReadSnapshot(size_t physical_offset, std::span<u8> data) {
+        return false;
+    }
+
+    void EndSnapshot() {}
+
     void EnableDirectMappedAddress() {
         // TODO
         UNREACHABLE();
@@ -425,10 +457,192 @@ static void* ChooseVirtualBase(size_t virtual_size) {
 
 #endif
 
+#ifdef HAS_USERFAULTFD_WP
+
+/**
+ * Tracks writes to read-only ranges with userfaultfd write protection instead of mprotect.
+ * Protection changes are range ioctls that never split the mapping, and writes to protected
+ * pages block the writing thread until the handler thread has reported them. The handler decides
+ * whether the page is unprotected, without waking the writer, and the writer is woken after it.
+ */
+class UserfaultWriteTracker {
+public:
+    explicit UserfaultWriteTracker(u8* base_, size_t size_) : base{base_}, size{size_} {
+        bool good = false;
+        SCOPE_EXIT {
+            if (!good) {
+                Release();
+            }
+        };
+
+#ifdef UFFD_USER_MODE_ONLY
+        // Only faults from user mode are needed, this is allowed without privileges
+        uffd = static_cast<int>(
+            syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+#endif
+        if (uffd < 0) {
+            uffd = static_cast<int>(syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK));
+        }
+        if (uffd < 0) {
+            LOG_INFO(HW_Memory, "userfaultfd unavailable: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        uffdio_api api{
+            .api = UFFD_API,
+            .features = UFFD_FEATURE_PAGEFAULT_FLAG_WP | UFFD_FEATURE_WP_HUGETLBFS_SHMEM,
+        };
+        if (ioctl(uffd, UFFDIO_API, &api) != 0) {
+            LOG_INFO(HW_Memory, "userfaultfd write protection unsupported: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        if (!Register(base, size)) {
+            throw std::bad_alloc{};
+        }
+
+        event_fd = eventfd(0, EFD_CLOEXEC);
+        if (event_fd < 0) {
+            LOG_ERROR(HW_Memory, "eventfd failed: {}", strerror(errno));
+            throw std::bad_alloc{};
+        }
+
+        fault_thread = std::jthread([this](std::stop_token stop_token) { FaultLoop(stop_token); });
+        good = true;
+    }
+
+    ~UserfaultWriteTracker() {
+        Release();
+    }
+
+    /// Registers a new mapping, mappings replaced with mmap lose their registration
+    bool Register(u8* pointer, size_t length) {
+        uffdio_register reg{
+            .range{
+                .start = reinterpret_cast<uintptr_t>(pointer),
+                .len = length,
+            },
+            .mode = UFFDIO_REGISTER_MODE_WP,
+        };
+        if (ioctl(uffd, UFFDIO_REGISTER, &reg) != 0) {
+            LOG_ERROR(HW_Memory, "UFFDIO_REGISTER failed: {}", strerror(errno));
+            return false;
+        }
+        return true;
+    }
+
+    /// Sets or clears write protection over a range, clearing it resumes blocked writers if wake
+    bool WriteProtect(u8* pointer, size_t length, bool protect, bool wake = true) {
+        u64 mode = protect ? static_cast<u64>(UFFDIO_WRITEPROTECT_MODE_WP) : 0;
+        if (!protect && !wake) {
+            mode |= UFFDIO_WRITEPROTECT_MODE_DONTWAKE;
+        }
+        uffdio_writeprotect wp{
+            .range{
+                .start = reinterpret_cast<uintptr_t>(pointer),
+                .len = length,
+            },
+            .mode = mode,
+        };
+        while (ioctl(uffd, UFFDIO_WRITEPROTECT, &wp) != 0) {
+            if (errno != EAGAIN) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SetHandler(HostMemory::WriteFaultHandler&& new_handler) {
+        std::scoped_lock lock{handler_mutex};
+        handler = std::move(new_handler);
+    }
+
+private:
+    void FaultLoop(std::stop_token stop_token) {
+        Common::SetCurrentThreadName("WriteFaultHandler");
+
+        std::array<pollfd, 2> fds{{
+            {.fd = uffd, .events = POLLIN, .revents = 0},
+            {.fd = event_fd, .events = POLLIN, .revents = 0},
+        }};
+        while (!stop_token.stop_requested()) {
+            if (poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG_ERROR(HW_Memory, "poll failed: {}", strerror(errno));
+                return;
+            }
+            if (fds[1].revents != 0) {
+                return;
+            }
+
+            uffd_msg msg;
+            if (read(uffd, &msg, sizeof(msg)) != static_cast<ssize_t>(sizeof(msg))) {
+                continue;
+            }
+            if (msg.event != UFFD_EVENT_PAGEFAULT ||
+                (msg.arg.pagefault.flags & UFFD_PAGEFAULT_FLAG_WP) == 0) {
+                continue;
+            }
+
+            const uintptr_t address = msg.arg.pagefault.address & ~(PageAlignment - 1);
+            u8* const page = reinterpret_cast<u8*>(address);
+            {
+                std::scoped_lock lock{handler_mutex};
+                if (handler) {
+                    handler(static_cast<size_t>(page - base), PageAlignment);
+                }
+            }
+
+            // If the page is still protected the writer faults again and is reported again
+            Wake(page, PageAlignment);
+        }
+    }
+
+    void Wake(u8* pointer, size_t length) {
+        uffdio_range range{
+            .start = reinterpret_cast<uintptr_t>(pointer),
+            .len = length,
+        };
+        ioctl(uffd, UFFDIO_WAKE, &range);
+    }
+
+    void Release() {
+        if (fault_thread.joinable()) {
+            fault_thread.request_stop();
+            const u64 value = 1;
+            [[maybe_unused]] const auto ret = write(event_fd, &value, sizeof(value));
+            fault_thread.join();
+        }
+        if (event_fd >= 0) {
+            close(event_fd);
+        }
+        if (uffd >= 0) {
+            // Closing the descriptor drops the registrations and wakes any blocked writer
+            WriteProtect(base, size, false);
+            close(uffd);
+        }
+    }
+
+    u8* base;
+    size_t size;
+    int uffd{-1};
+    int event_fd{-1};
+
+    std::mutex handler_mutex;
+    HostMemory::WriteFaultHandler handler;
+
+    std::jthread fault_thread;
+};
+
+#endif
+
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t backing_size_, size_t virtual_size_)
-        : backing_size{backing_size_}, virtual_size{virtual_size_} {
+    explicit Impl(size_t backing_size_, size_t virtual_size_, bool use_huge_pages_)
+        : backing_size{backing_size_}, virtual_size{virtual_size_},
+          use_huge_pages{use_huge_pages_} {
         bool good = false;
         SCOPE_EXIT {
             if (!good) {
@@ -468,6 +682,19 @@ public:
             LOG_CRITICAL(HW_Memory, "mmap failed: {}", strerror(errno));
             throw std::bad_alloc{};
         }
+#if defined(__linux__)
+        if (use_huge_pages) {
+            // Pages of the memfd are allocated on first touch, ask for them to be huge pages.
+            // shmem only honors this when shmem_enabled is not "never" or "deny".
+            if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+                LOG_WARNING(HW_Memory, "Huge pages unavailable for guest memory: {}",
+                            strerror(errno));
+                use_huge_pages = false;
+            } else {
+                LOG_INFO(HW_Memory, "Backing guest memory with transparent huge pages");
+            }
+        }
+#endif
 
         // Virtual memory initialization
         virtual_base = virtual_map_base = static_cast<u8*>(ChooseVirtualBase(virtual_size));
@@ -511,6 +738,40 @@ public:
         void* ret = mmap(virtual_base + virtual_offset, length, flags, MAP_SHARED | MAP_FIXED, fd,
                          host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+#if defined(__linux__)
+        if (use_huge_pages && length >= HugePageSize) {
+            // The advice is per mapping, so it has to be given again for every new mapping.
+            // Huge pages are only mapped where the offsets agree modulo the huge page size,
+            // mappings with different permissions are split back to small pages by the kernel.
+            madvise(virtual_base + virtual_offset, length, MADV_HUGEPAGE);
+            if ((virtual_offset - host_offset) % HugePageSize != 0) {
+                LOG_DEBUG(HW_Memory, "Mapping {:#x} -> {:#x} ({:#x} bytes) cannot use huge pages",
+                          virtual_offset, host_offset, length);
+            }
+        }
+#endif
+
+#ifdef HAS_USERFAULTFD_WP
+        {
+            std::scoped_lock lock{protect_mutex};
+            const auto range = ProtectInterval(virtual_offset, length);
+            virtual_to_host.set(std::make_pair(range, host_offset - virtual_offset));
+            write_protected_ranges -= range;
+            if (write_tracker) {
+                if (flags == (PROT_READ | PROT_WRITE)) {
+                    protected_ranges -= range;
+                } else {
+                    protected_ranges += range;
+                }
+                write_tracker->Register(virtual_base + virtual_offset, length);
+                if (snapshot_active) {
+                    // The new mapping may alias pages that have not been copied yet
+                    write_tracker->WriteProtect(virtual_base + virtual_offset, length, true);
+                }
+            }
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -527,6 +788,17 @@ public:
         void* ret = mmap(merged_pointer, merged_size, PROT_NONE,
                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+
+#ifdef HAS_USERFAULTFD_WP
+        {
+            // Placeholders are never protected through the tracker, forget about them
+            std::scoped_lock lock{protect_mutex};
+            const auto range = ProtectInterval(virtual_offset, length);
+            virtual_to_host.erase(range);
+            write_protected_ranges -= range;
+            protected_ranges -= range;
+        }
+#endif
     }
 
     void Protect(size_t virtual_offset, size_t length, bool read, bool write, bool execute) {
@@ -545,11 +817,171 @@ public:
             flags |= PROT_EXEC;
         }
 #endif
+
+#ifdef HAS_USERFAULTFD_WP
+        if (write_tracker) {
+            std::scoped_lock lock{protect_mutex};
+            u8* const pointer = virtual_base + virtual_offset;
+            const auto range = ProtectInterval(virtual_offset, length);
+            // Pages still write protected for a snapshot are unprotected once they are copied
+            const bool unprotect = !snapshot_active;
+            if (handles_write_faults && (flags & ~PROT_WRITE) == PROT_READ) {
+                // Keep the mapping read-write and track writes with userfaultfd.
+                // Only ranges mprotected before need their protection restored.
+                if (boost::icl::intersects(protected_ranges, range)) {
+                    int ret = mprotect(pointer, length, PROT_READ | PROT_WRITE);
+                    ASSERT_MSG(ret == 0, "mprotect failed: {}", strerror(errno));
+                    protected_ranges -= range;
+                }
+                if (write) {
+                    write_protected_ranges -= range;
+                    if (!unprotect || write_tracker->WriteProtect(pointer, length, false)) {
+                        return;
+                    }
+                } else if (write_tracker->WriteProtect(pointer, length, true)) {
+                    write_protected_ranges += range;
+                    return;
+                }
+            } else if (unprotect) {
+                write_tracker->WriteProtect(pointer, length, false);
+            }
+            write_protected_ranges -= range;
+            protected_ranges += range;
+        }
+#endif
+
         int ret = mprotect(virtual_base + virtual_offset, length, flags);
         ASSERT_MSG(ret == 0, "mprotect failed: {}", strerror(errno));
     }
 
+    bool SetWriteFaultHandler(WriteFaultHandler&& handler) {
+#ifdef HAS_USERFAULTFD_WP
+        std::unique_ptr<UserfaultWriteTracker> old_tracker;
+        {
+            std::scoped_lock lock{protect_mutex};
+            if (!handler) {
+                handles_write_faults = false;
+                write_protected_ranges.clear();
+                if (!snapshot_active) {
+                    old_tracker = std::move(write_tracker);
+                }
+            } else if (!CreateWriteTracker()) {
+                return false;
+            }
+        }
+        // The fault thread may be waiting on the lock, so the tracker is destroyed without it
+        old_tracker.reset();
+
+        std::scoped_lock lock{handler_mutex};
+        write_fault_handler = std::move(handler);
+        handles_write_faults = static_cast<bool>(write_fault_handler);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool BeginSnapshot() {
+#ifdef HAS_USERFAULTFD_WP
+        std::scoped_lock lock{protect_mutex};
+        if (snapshot_active || virtual_base == nullptr || !CreateWriteTracker()) {
+            return false;
+        }
+        try {
+            snapshot_tracker = std::make_unique<UserfaultWriteTracker>(backing_base, backing_size);
+        } catch (const std::bad_alloc&) {
+            return false;
+        }
+        snapshot_tracker->SetHandler([this](size_t physical_offset, size_t length) {
+            std::scoped_lock snapshot_lock{snapshot_mutex};
+            if (snapshot_active) {
+                CopySnapshotPage(physical_offset);
+                snapshot_tracker->WriteProtect(backing_base + physical_offset, length, false,
+                                               false);
+            }
+        });
+
+        // Every view of the memfd has to be protected, writes through any of them copy the page
+        snapshot_active = true;
+        snapshot_tracker->WriteProtect(backing_base, backing_size, true);
+        for (const auto& [range, host_delta] : virtual_to_host) {
+            write_tracker->WriteProtect(virtual_base + range.lower(), boost::icl::length(range),
+                                        true);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool ReadSnapshot(size_t physical_offset, std::span<u8> data) {
+#ifdef HAS_USERFAULTFD_WP
+        std::scoped_lock lock{snapshot_mutex};
+        if (!snapshot_active) {
+            return false;
+        }
+        // Writers fault on pages that have not been copied and wait for the lock to copy them,
+        // so the backing memory of those pages is still unchanged while it is held.
+        size_t offset = 0;
+        while (offset < data.size()) {
+            const size_t address = physical_offset + offset;
+            const size_t page = address & ~(PageAlignment - 1);
+            const size_t page_offset = address - page;
+            const size_t copy_size = std::min(PageAlignment - page_offset, data.size() - offset);
+            const auto it = snapshot_pages.find(page);
+            const u8* const source =
+                it != snapshot_pages.end() ? it->second->data() : backing_base + page;
+            std::memcpy(data.data() + offset, source + page_offset, copy_size);
+            offset += copy_size;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void EndSnapshot() {
+#ifdef HAS_USERFAULTFD_WP
+        std::unique_ptr<UserfaultWriteTracker> old_snapshot_tracker;
+        std::unique_ptr<UserfaultWriteTracker> old_tracker;
+        {
+            std::scoped_lock lock{protect_mutex, snapshot_mutex};
+            if (!snapshot_active) {
+                return;
+            }
+            snapshot_active = false;
+            old_snapshot_tracker = std::move(snapshot_tracker);
+            if (!handles_write_faults) {
+                old_tracker = std::move(write_tracker);
+            } else {
+                // Keep the pages protected for the write fault handler
+                boost::icl::interval_set<size_t> unprotect;
+                for (const auto& [range, host_delta] : virtual_to_host) {
+                    unprotect += range;
+                }
+                unprotect -= write_protected_ranges;
+                for (const auto& range : unprotect) {
+                    write_tracker->WriteProtect(virtual_base + range.lower(),
+                                                boost::icl::length(range), false);
+                }
+            }
+        }
+        // Destroying the trackers unprotects their ranges and resumes any blocked writer
+        old_snapshot_tracker.reset();
+        old_tracker.reset();
+
+        std::scoped_lock lock{snapshot_mutex};
+        snapshot_pages.clear();
+#endif
+    }
+
     bool ClearBackingRegion(size_t physical_offset, size_t length) {
+#ifdef HAS_USERFAULTFD_WP
+        if (snapshot_active) {
+            // Dropping pages bypasses the write protection, the snapshot would miss the change
+            return false;
+        }
+#endif
 #ifdef __linux__
         // Set MADV_REMOVE on backing map to destroy it instantly.
         // This also deletes the area from the backing file.
@@ -563,11 +995,16 @@ public:
     }
 
     void EnableDirectMappedAddress() {
+#ifdef HAS_USERFAULTFD_WP
+        EndSnapshot();
+        write_tracker.reset();
+#endif
         virtual_base = nullptr;
     }
 
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
+    bool use_huge_pages;       ///< Whether mappings are advised to use huge pages
 
     u8* backing_base{reinterpret_cast<u8*>(MAP_FAILED)};
     u8* virtual_base{reinterpret_cast<u8*>(MAP_FAILED)};
@@ -576,6 +1013,11 @@ public:
 private:
     /// Release all resources in the object
     void Release() {
+#ifdef HAS_USERFAULTFD_WP
+        snapshot_tracker.reset();
+        write_tracker.reset();
+#endif
+
         if (virtual_map_base != MAP_FAILED) {
             int ret = munmap(virtual_map_base, virtual_size);
             ASSERT_MSG(ret == 0, "munmap failed: {}", strerror(errno));
@@ -613,15 +1055,106 @@ private:
         }
     }
 
+#ifdef HAS_USERFAULTFD_WP
+    static boost::icl::interval<size_t>::type ProtectInterval(size_t virtual_offset,
+                                                              size_t length) {
+        return boost::icl::interval<size_t>::right_open(virtual_offset, virtual_offset + length);
+    }
+
+    /// Creates the tracker of the virtual range if needed, must be called with protect_mutex held
+    bool CreateWriteTracker() {
+        if (write_tracker) {
+            return true;
+        }
+        if (virtual_base == nullptr) {
+            return false;
+        }
+        try {
+            write_tracker = std::make_unique<UserfaultWriteTracker>(virtual_base, virtual_size);
+        } catch (const std::bad_alloc&) {
+            return false;
+        }
+        write_tracker->SetHandler([this](size_t virtual_offset, size_t length) {
+            HandleVirtualWriteFault(virtual_offset, length);
+        });
+        LOG_INFO(HW_Memory, "Tracking writes to protected memory with userfaultfd");
+        return true;
+    }
+
+    void HandleVirtualWriteFault(size_t virtual_offset, size_t length) {
+        bool notify = false;
+        {
+            std::scoped_lock lock{protect_mutex};
+            if (snapshot_active) {
+                const auto it = virtual_to_host.find(virtual_offset);
+                if (it != virtual_to_host.end()) {
+                    std::scoped_lock snapshot_lock{snapshot_mutex};
+                    CopySnapshotPage(virtual_offset + it->second);
+                }
+            }
+            // Faults also come from pages only protected for the snapshot
+            const auto range = ProtectInterval(virtual_offset, length);
+            notify = boost::icl::intersects(write_protected_ranges, range);
+            write_protected_ranges -= range;
+
+            // The writer resumes once the handler returns. Protecting the page again from now on,
+            // even before that, makes the write fault again instead of being lost.
+            if (write_tracker) {
+                write_tracker->WriteProtect(virtual_base + virtual_offset, length, false, false);
+            }
+        }
+        if (notify) {
+            std::scoped_lock lock{handler_mutex};
+            if (write_fault_handler) {
+                write_fault_handler(virtual_offset, length);
+            }
+        }
+    }
+
+    /// Copies a page of the backing memory before it is first written during a snapshot.
+    /// Must be called with snapshot_mutex held.
+    void CopySnapshotPage(size_t physical_offset) {
+        if (!snapshot_active) {
+            return;
+        }
+        const auto [it, is_new] = snapshot_pages.try_emplace(physical_offset);
+        if (is_new) {
+            it->second = std::make_unique<SnapshotPage>();
+            std::memcpy(it->second->data(), backing_base + physical_offset, PageAlignment);
+        }
+    }
+#endif
+
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
     FreeRegionManager free_manager{};
+
+#ifdef HAS_USERFAULTFD_WP
+    using SnapshotPage = std::array<u8, PageAlignment>;
+
+    std::unique_ptr<UserfaultWriteTracker> write_tracker;
+    std::mutex protect_mutex;
+    boost::icl::interval_set<size_t> protected_ranges; ///< Ranges mprotected to other than RW
+    boost::icl::interval_set<size_t> write_protected_ranges; ///< Ranges reported on writes
+    /// Distance from each mapped virtual range to the backing memory it maps, modulo 2^64
+    boost::icl::interval_map<size_t, size_t, boost::icl::partial_enricher> virtual_to_host;
+
+    std::mutex handler_mutex;
+    WriteFaultHandler write_fault_handler;
+    std::atomic_bool handles_write_faults{};
+
+    std::unique_ptr<UserfaultWriteTracker> snapshot_tracker; ///< Tracks the backing memory view
+    std::mutex snapshot_mutex;
+    std::unordered_map<size_t, std::unique_ptr<SnapshotPage>> snapshot_pages;
+    std::atomic_bool snapshot_active{};
+#endif
 };
 
 #else // ^^^ Linux ^^^ vvv Generic vvv
 
 class HostMemory::Impl {
 public:
-    explicit Impl(size_t /*backing_size */, size_t /* virtual_size */) {
+    explicit Impl(size_t /*backing_size */, size_t /* virtual_size */,
+                  bool /* use_huge_pages */) {
         // This is just a place holder.
         // Please implement fastmem in a proper way on your platform.
         throw std::bad_alloc{};
@@ -633,10 +1166,24 @@ public:
 
     void Protect(size_t virtual_offset, size_t length, bool read, bool write, bool execute) {}
 
+    bool SetWriteFaultHandler(WriteFaultHandler&& handler) {
+        return false;
+    }
+
     bool ClearBackingRegion(size_t physical_offset, size_t length) {
         return false;
     }
 
+    bool BeginSnapshot() {
+        return false;
+    }
+
+    bool ReadSnapshot(size_t physical_offset, std::span<u8> data) {
+        return false;
+    }
+
+    void EndSnapshot() {}
+
     void EnableDirectMappedAddress() {}
 
     u8* backing_base{nullptr};
@@ -645,14 +1192,14 @@ public:
 
 #endif // ^^^ Generic ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
         // The implementation will fail with std::bad_alloc on errors.
-        impl =
-            std::make_unique<HostMemory::Impl>(AlignUp(backing_size, PageAlignment),
-                                               AlignUp(virtual_size, PageAlignment) + HugePageSize);
+        impl = std::make_unique<HostMemory::Impl>(
+            AlignUp(backing_size, PageAlignment),
+            AlignUp(virtual_size, PageAlignment) + HugePageSize, use_huge_pages);
         backing_base = impl->backing_base;
         virtual_base = impl->virtual_base;
 
@@ -714,12 +1261,48 @@ void HostMemory::Protect(size_t virtual_offset, size_t length, MemoryPermission
     impl->Protect(virtual_offset + virtual_base_offset, length, read, write, execute);
 }
 
+bool HostMemory::SetWriteFaultHandler(WriteFaultHandler handler) {
+    if (!virtual_base || !impl) {
+        return false;
+    }
+    if (!handler) {
+        return impl->SetWriteFaultHandler({});
+    }
+    return impl->SetWriteFaultHandler(
+        [this, handler = std::move(handler)](size_t virtual_offset, size_t length) {
+            if (virtual_offset >= virtual_base_offset) {
+                handler(virtual_offset - virtual_base_offset, length);
+            }
+        });
+}
+
 void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value) {
     if (!impl || fill_value != 0 || !impl->ClearBackingRegion(physical_offset, length)) {
         std::memset(backing_base + physical_offset, fill_value, length);
     }
 }
 
+void HostMemory::ReleaseBackingRegion(size_t physical_offset, size_t length) {
+    if (impl) {
+        impl->ClearBackingRegion(physical_offset, length);
+    }
+}
+
+bool HostMemory::BeginSnapshot() {
+    return impl && impl->BeginSnapshot();
+}
+
+bool HostMemory::ReadSnapshot(size_t physical_offset, std::span<u8> data) {
+    ASSERT(physical_offset + data.size() <= backing_size);
+    return impl && impl->ReadSnapshot(physical_offset, data);
+}
+
+void HostMemory::EndSnapshot() {
+    if (impl) {
+        impl->EndSnapshot();
+    }
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
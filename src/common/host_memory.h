@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <span>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/virtual_buffer.h"
@@ -24,7 +26,14 @@ DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    /// Called with the virtual offset and length of a write to a write protected range
+    using WriteFaultHandler = std::function<void(size_t virtual_offset, size_t length)>;
+
+    /**
+     * @param use_huge_pages Back the memory with transparent huge pages where the host allows it,
+     *                       reducing TLB pressure of fastmem accesses
+     */
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_, bool use_huge_pages = false);
     ~HostMemory();
 
     /**
@@ -47,10 +56,34 @@ public:
 
     void Protect(size_t virtual_offset, size_t length, MemoryPermission perms);
 
+    /**
+     * Delivers writes to read-only ranges to a handler thread instead of faulting, when the
+     * platform supports it. The writing thread is blocked until the handler returns, and the
+     * written page is left writable. An empty handler disables the tracking.
+     * Returns false when unsupported, read-only ranges then keep faulting as before.
+     */
+    bool SetWriteFaultHandler(WriteFaultHandler handler);
+
     void EnableDirectMappedAddress();
 
     void ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value);
 
+    /// Returns the backing pages of a region to the host where supported, their contents are lost
+    void ReleaseBackingRegion(size_t physical_offset, size_t length);
+
+    /**
+     * Starts a copy-on-write snapshot of the backing memory. Pages are copied out before they are
+     * first written, so starting it copies nothing. Writers have to be paused while it starts.
+     * Returns false when unsupported or when a snapshot is already active.
+     */
+    bool BeginSnapshot();
+
+    /// Reads the backing memory as it was when the snapshot began, false without a snapshot
+    bool ReadSnapshot(size_t physical_offset, std::span<u8> data);
+
+    /// Stops the active snapshot and frees the pages copied for it
+    void EndSnapshot();
+
     [[nodiscard]] u8* BackingBasePointer() noexcept {
         return backing_base;
     }
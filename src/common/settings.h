@@ -198,6 +198,7 @@ struct Values {
                                                              MemoryLayout::Memory_8Gb,
                                                              "memory_layout_mode",
                                                              Category::Core};
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
     SwitchableSetting<bool> use_speed_limit{
         linkage, true, "use_speed_limit", Category::Core, Specialization::Paired, false, true};
     SwitchableSetting<u16, true> speed_limit{linkage,
@@ -397,6 +398,8 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> low_latency_presentation{linkage, false, "low_latency_presentation",
+                                                     Category::RendererAdvanced};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
@@ -421,6 +424,22 @@ struct Values {
                                                              true};
     SwitchableSetting<bool> enable_compute_pipelines{linkage, false, "enable_compute_pipelines",
                                                      Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_graphics_pipeline_library{
+        linkage, false, "use_vulkan_graphics_pipeline_library", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_shader_objects{linkage, false, "use_vulkan_shader_objects",
+                                                      Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_dynamic_rendering{
+        linkage, false, "use_vulkan_dynamic_rendering", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_descriptor_buffer{
+        linkage, false, "use_vulkan_descriptor_buffer", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_host_memory_import{
+        linkage, false, "use_vulkan_host_memory_import", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_vulkan_async_compute{linkage, false, "use_vulkan_async_compute",
+                                                     Category::RendererAdvanced};
+    SwitchableSetting<bool> use_parallel_command_recording{
+        linkage, false, "use_parallel_command_recording", Category::RendererAdvanced};
+    SwitchableSetting<bool> use_gl_bindless_textures{linkage, false, "use_gl_bindless_textures",
+                                                     Category::RendererAdvanced};
     SwitchableSetting<bool> use_video_framerate{linkage, false, "use_video_framerate",
                                                 Category::RendererAdvanced};
     SwitchableSetting<bool> barrier_feedback_loops{linkage, true, "barrier_feedback_loops",
@@ -437,6 +456,8 @@ struct Values {
                                           Category::RendererDebug};
     Setting<bool> disable_buffer_reorder{linkage, false, "disable_buffer_reorder",
                                          Category::RendererDebug};
+    Setting<bool> null_renderer_simulation{linkage, false, "null_renderer_simulation",
+                                           Category::RendererDebug};
 
     // System
     SwitchableSetting<Language, true> language_index{linkage,
@@ -583,6 +604,8 @@ struct Values {
         false};
     Setting<bool> dump_macros{
         linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
+    Setting<bool> gpu_trace_capture{linkage, false, "gpu_trace_capture",
+                                    Category::DebuggingGraphics, Specialization::Default, false};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
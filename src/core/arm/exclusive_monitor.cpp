@@ -5,6 +5,7 @@
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #endif
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/reservation_exclusive_monitor.h"
 #include "core/memory.h"
 
 namespace Core {
@@ -16,8 +17,7 @@ std::unique_ptr<Core::ExclusiveMonitor> MakeExclusiveMonitor(Memory::Memory& mem
 #if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
     return std::make_unique<Core::DynarmicExclusiveMonitor>(memory, num_cores);
 #else
-    // TODO(merry): Passthrough exclusive monitor
-    return nullptr;
+    return std::make_unique<Core::ReservationExclusiveMonitor>(memory, num_cores);
 #endif
 }
 
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "core/arm/reservation_exclusive_monitor.h"
+#include "core/memory.h"
+
+namespace Core {
+namespace {
+
+/// Addresses in the same granule share a slot, it is large enough for 128-bit accesses
+constexpr std::size_t RESERVATION_GRANULE_BITS = 4;
+
+} // Anonymous namespace
+
+ReservationExclusiveMonitor::ReservationExclusiveMonitor(Memory::Memory& memory_,
+                                                         std::size_t core_count_)
+    : memory{memory_}, reservations(core_count_) {}
+
+ReservationExclusiveMonitor::~ReservationExclusiveMonitor() = default;
+
+std::size_t ReservationExclusiveMonitor::SlotIndex(VAddr addr) {
+    // Fibonacci hashing, so neighbouring granules do not share a cache line of the table
+    const u64 granule = addr >> RESERVATION_GRANULE_BITS;
+    return static_cast<std::size_t>((granule * 0x9E3779B97F4A7C15ULL) >> (64 - NUM_SLOT_BITS));
+}
+
+template <typename T, typename Func>
+T ReservationExclusiveMonitor::ReadAndMark(std::size_t core_index, VAddr addr, Func&& read) {
+    const std::atomic<u64>& version = slots[SlotIndex(addr)].version;
+    u64 current_version = version.load(std::memory_order_acquire);
+    while ((current_version & 1) != 0) {
+        // A write is being committed, it only takes a compare-and-swap of guest memory
+        current_version = version.load(std::memory_order_acquire);
+    }
+    const T value = read();
+
+    Reservation& reservation = reservations[core_index];
+    reservation.address = addr;
+    reservation.version = current_version;
+    std::memcpy(reservation.value.data(), &value, sizeof(T));
+    return value;
+}
+
+template <typename T, typename Func>
+bool ReservationExclusiveMonitor::DoExclusiveOperation(std::size_t core_index, VAddr addr,
+                                                       Func&& write) {
+    Reservation& reservation = reservations[core_index];
+    if (reservation.address != addr) {
+        return false;
+    }
+    reservation.address = INVALID_EXCLUSIVE_ADDRESS;
+
+    // Taking the slot fails if any core committed to it since the read, and makes the writes of
+    // other cores holding a reservation in it fail
+    std::atomic<u64>& version = slots[SlotIndex(addr)].version;
+    u64 expected_version = reservation.version;
+    if (!version.compare_exchange_strong(expected_version, expected_version + 1,
+                                         std::memory_order_acquire, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    T expected;
+    std::memcpy(&expected, reservation.value.data(), sizeof(T));
+    const bool result = write(expected);
+
+    // Versions only move forward, a stale reservation can never match again
+    version.store(expected_version + 2, std::memory_order_release);
+    return result;
+}
+
+u8 ReservationExclusiveMonitor::ExclusiveRead8(std::size_t core_index, VAddr addr) {
+    return ReadAndMark<u8>(core_index, addr, [&]() -> u8 { return memory.Read8(addr); });
+}
+
+u16 ReservationExclusiveMonitor::ExclusiveRead16(std::size_t core_index, VAddr addr) {
+    return ReadAndMark<u16>(core_index, addr, [&]() -> u16 { return memory.Read16(addr); });
+}
+
+u32 ReservationExclusiveMonitor::ExclusiveRead32(std::size_t core_index, VAddr addr) {
+    return ReadAndMark<u32>(core_index, addr, [&]() -> u32 { return memory.Read32(addr); });
+}
+
+u64 ReservationExclusiveMonitor::ExclusiveRead64(std::size_t core_index, VAddr addr) {
+    return ReadAndMark<u64>(core_index, addr, [&]() -> u64 { return memory.Read64(addr); });
+}
+
+u128 ReservationExclusiveMonitor::ExclusiveRead128(std::size_t core_index, VAddr addr) {
+    return ReadAndMark<u128>(core_index, addr, [&]() -> u128 {
+        u128 result;
+        result[0] = memory.Read64(addr);
+        result[1] = memory.Read64(addr + 8);
+        return result;
+    });
+}
+
+void ReservationExclusiveMonitor::ClearExclusive(std::size_t core_index) {
+    reservations[core_index].address = INVALID_EXCLUSIVE_ADDRESS;
+}
+
+bool ReservationExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
+    return DoExclusiveOperation<u8>(core_index, vaddr, [&](u8 expected) -> bool {
+        return memory.WriteExclusive8(vaddr, value, expected);
+    });
+}
+
+bool ReservationExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr,
+                                                   u16 value) {
+    return DoExclusiveOperation<u16>(core_index, vaddr, [&](u16 expected) -> bool {
+        return memory.WriteExclusive16(vaddr, value, expected);
+    });
+}
+
+bool ReservationExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr,
+                                                   u32 value) {
+    return DoExclusiveOperation<u32>(core_index, vaddr, [&](u32 expected) -> bool {
+        return memory.WriteExclusive32(vaddr, value, expected);
+    });
+}
+
+bool ReservationExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr,
+                                                   u64 value) {
+    return DoExclusiveOperation<u64>(core_index, vaddr, [&](u64 expected) -> bool {
+        return memory.WriteExclusive64(vaddr, value, expected);
+    });
+}
+
+bool ReservationExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr,
+                                                    u128 value) {
+    return DoExclusiveOperation<u128>(core_index, vaddr, [&](u128 expected) -> bool {
+        return memory.WriteExclusive128(vaddr, value, expected);
+    });
+}
+
+} // namespace Core
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/arm/exclusive_monitor.h"
+
+namespace Core::Memory {
+class Memory;
+}
+
+namespace Core {
+
+/**
+ * Exclusive monitor without a global lock, for when no JIT shares the monitor with the kernel.
+ *
+ * Addresses hash to slots holding a version. Exclusive reads record the version of their slot,
+ * and exclusive writes commit by moving it forward with a compare-and-swap. A write fails if
+ * another core committed to the same slot since the read, so exclusive operations on addresses in
+ * different slots never contend.
+ */
+class ReservationExclusiveMonitor final : public ExclusiveMonitor {
+public:
+    explicit ReservationExclusiveMonitor(Memory::Memory& memory_, std::size_t core_count_);
+    ~ReservationExclusiveMonitor() override;
+
+    u8 ExclusiveRead8(std::size_t core_index, VAddr addr) override;
+    u16 ExclusiveRead16(std::size_t core_index, VAddr addr) override;
+    u32 ExclusiveRead32(std::size_t core_index, VAddr addr) override;
+    u64 ExclusiveRead64(std::size_t core_index, VAddr addr) override;
+    u128 ExclusiveRead128(std::size_t core_index, VAddr addr) override;
+    void ClearExclusive(std::size_t core_index) override;
+
+    bool ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) override;
+    bool ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) override;
+    bool ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) override;
+    bool ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) override;
+    bool ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) override;
+
+private:
+    static constexpr std::size_t NUM_SLOT_BITS = 10;
+    static constexpr std::size_t NUM_SLOTS = 1ULL << NUM_SLOT_BITS;
+    static constexpr VAddr INVALID_EXCLUSIVE_ADDRESS = ~VAddr{0};
+
+    /// Version of a slot, it is odd while a write to one of its addresses is being committed
+    struct alignas(64) Slot {
+        std::atomic<u64> version{};
+    };
+
+    /// Only accessed by the core it belongs to
+    struct alignas(64) Reservation {
+        VAddr address{INVALID_EXCLUSIVE_ADDRESS};
+        u64 version{};
+        u128 value{};
+    };
+
+    static std::size_t SlotIndex(VAddr addr);
+
+    template <typename T, typename Func>
+    T ReadAndMark(std::size_t core_index, VAddr addr, Func&& read);
+
+    template <typename T, typename Func>
+    bool DoExclusiveOperation(std::size_t core_index, VAddr addr, Func&& write);
+
+    Core::Memory::Memory& memory;
+    std::array<Slot, NUM_SLOTS> slots{};
+    std::vector<Reservation> reservations;
+};
+
+} // namespace Core
@@ -429,6 +429,30 @@ struct System::Impl {
         return status;
     }
 
+    SystemResultStatus SetupForGpuReplay(System& system, Frontend::EmuWindow& emu_window) {
+        InitializeKernel(system);
+
+        telemetry_session = std::make_unique<Core::TelemetrySession>();
+
+        host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
+        gpu_core = VideoCore::CreateGPU(emu_window, system);
+        if (!gpu_core) {
+            return SystemResultStatus::ErrorVideoCore;
+        }
+
+        is_powered_on = true;
+        exit_locked = false;
+        exit_requested = false;
+
+        perf_stats = std::make_unique<PerfStats>(0);
+        GetAndResetPerfStats();
+        perf_stats->BeginSystemFrame();
+
+        LOG_DEBUG(Core, "Initialized OK");
+
+        return SystemResultStatus::Success;
+    }
+
     void ShutdownMainProcess() {
         SetShuttingDown(true);
 
@@ -691,6 +715,10 @@ SystemResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::stri
     return impl->Load(*this, emu_window, filepath, params);
 }
 
+SystemResultStatus System::SetupForGpuReplay(Frontend::EmuWindow& emu_window) {
+    return impl->SetupForGpuReplay(*this, emu_window);
+}
+
 bool System::IsPoweredOn() const {
     return impl->is_powered_on.load(std::memory_order::relaxed);
 }
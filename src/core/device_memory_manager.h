@@ -51,6 +51,9 @@ public:
 
     void Map(DAddr address, VAddr virtual_address, size_t size, Asid asid, bool track = false);
 
+    /// Maps device memory straight to physical memory, without any process backing it
+    void MapPhysical(DAddr address, PAddr physical_address, size_t size);
+
     void Unmap(DAddr address, size_t size);
 
     void TrackContinuityImpl(DAddr address, VAddr virtual_address, size_t size, Asid asid);
@@ -150,6 +153,8 @@ private:
 
     void InnerGatherDeviceAddresses(Common::ScratchBuffer<u32>& buffer, PAddr address);
 
+    void MapPage(size_t device_page, u32 phys_addr);
+
     std::unique_ptr<DeviceMemoryManagerAllocator<Traits>> impl;
 
     const uintptr_t physical_base;
@@ -456,6 +456,23 @@ size_t KMemoryManager::Impl::Initialize(KPhysicalAddress address, size_t size,
     return total_management_size;
 }
 
+void KMemoryManager::Impl::ReleaseFreePagesImpl(Core::System& system) {
+    // Release the large runs of free pages, dropping their contents.
+    // Pages are only in the set while they are free, allocations remove them.
+    boost::icl::interval_set<u64> released;
+    for (const auto& interval : m_unreleased_free_pages) {
+        const u64 size = interval.upper() - interval.lower();
+        if (size < FreePageReleaseMinimumSize) {
+            continue;
+        }
+        system.DeviceMemory().buffer.ReleaseBackingRegion(
+            interval.lower() - Core::DramMemoryMap::Base, size);
+        released += interval;
+    }
+    m_unreleased_free_pages -= released;
+    m_unreleased_free_size = 0;
+}
+
 void KMemoryManager::Impl::InitializeOptimizedMemory(KernelCore& kernel) {
     auto optimize_pa = KPageTable::GetHeapPhysicalAddress(kernel, m_management_region);
     auto* optimize_map = kernel.System().DeviceMemory().GetPointer<u64>(optimize_pa);
@@ -6,6 +6,8 @@
 #include <array>
 #include <tuple>
 
+#include <boost/icl/interval_set.hpp>
+
 #include "common/common_funcs.h"
 #include "core/hle/kernel/k_light_lock.h"
 #include "core/hle/kernel/k_memory_layout.h"
@@ -105,6 +107,7 @@ public:
             {
                 KScopedLightLock lk(m_pool_locks[static_cast<size_t>(manager.GetPool())]);
                 manager.Close(address, cur_pages);
+                manager.ReleaseFreePages(m_system);
             }
 
             num_pages -= cur_pages;
@@ -203,13 +206,34 @@ private:
                           KVirtualAddress management_end, Pool p);
 
         KPhysicalAddress AllocateBlock(s32 index, bool random) {
-            return m_heap.AllocateBlock(index, random);
+            const KPhysicalAddress block = m_heap.AllocateBlock(index, random);
+            if (block != 0) {
+                this->UnmarkFreePages(block, KPageHeap::GetBlockNumPages(index));
+            }
+            return block;
         }
         KPhysicalAddress AllocateAligned(s32 index, size_t num_pages, size_t align_pages) {
-            return m_heap.AllocateAligned(index, num_pages, align_pages);
+            const KPhysicalAddress block = m_heap.AllocateAligned(index, num_pages, align_pages);
+            if (block != 0) {
+                // The heap may have split a larger block, the remainder stays unreleased
+                this->UnmarkFreePages(block,
+                                      std::max(num_pages, KPageHeap::GetBlockNumPages(index)));
+            }
+            return block;
         }
         void Free(KPhysicalAddress addr, size_t num_pages) {
             m_heap.Free(addr, num_pages);
+
+            // Remember the pages so their host memory can be released later
+            m_unreleased_free_pages += MakeFreePageInterval(addr, num_pages);
+            m_unreleased_free_size += num_pages * PageSize;
+        }
+
+        /// Returns the host memory behind free pages to the host, once enough has been freed
+        void ReleaseFreePages(Core::System& system) {
+            if (m_unreleased_free_size >= FreePageReleaseThreshold) {
+                this->ReleaseFreePagesImpl(system);
+            }
         }
 
         void SetInitialUsedHeapSize(size_t reserved_size) {
@@ -320,9 +344,29 @@ private:
 
     private:
         using RefCount = u16;
+        using FreePageInterval = boost::icl::interval<u64>;
+
+        /// Amount of memory freed before the free pages are released to the host
+        static constexpr size_t FreePageReleaseThreshold = 64_MiB;
+        /// Smallest run of free pages released to the host, smaller runs wait to be coalesced
+        static constexpr size_t FreePageReleaseMinimumSize = 2_MiB;
+
+        static FreePageInterval::type MakeFreePageInterval(KPhysicalAddress addr,
+                                                           size_t num_pages) {
+            return FreePageInterval::right_open(GetInteger(addr),
+                                                GetInteger(addr) + num_pages * PageSize);
+        }
+
+        void UnmarkFreePages(KPhysicalAddress addr, size_t num_pages) {
+            m_unreleased_free_pages -= MakeFreePageInterval(addr, num_pages);
+        }
+
+        void ReleaseFreePagesImpl(Core::System& system);
 
         KPageHeap m_heap;
         std::vector<RefCount> m_page_reference_counts;
+        boost::icl::interval_set<u64> m_unreleased_free_pages;
+        size_t m_unreleased_free_size{};
         KVirtualAddress m_management_region{};
         Pool m_pool{};
         Impl* m_next{};
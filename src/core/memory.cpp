@@ -46,12 +46,25 @@ bool AddressSpaceContains(const Common::PageTable& table, const Common::ProcessA
 struct Memory::Impl {
     explicit Impl(Core::System& system_) : system{system_} {}
 
+    ~Impl() {
+        if (write_faults_handled) {
+            system.DeviceMemory().buffer.SetWriteFaultHandler({});
+        }
+    }
+
     void SetCurrentPageTable(Kernel::KProcess& process) {
         current_page_table = &process.GetPageTable().GetImpl();
 
         if (std::addressof(process) == system.ApplicationProcess() &&
             Settings::IsFastmemEnabled()) {
             current_page_table->fastmem_arena = system.DeviceMemory().buffer.VirtualBasePointer();
+
+            // Where supported, fastmem writes to rasterizer cached pages are reported here instead
+            // of faulting into the slow path of the JIT.
+            if (!write_faults_handled) {
+                write_faults_handled = system.DeviceMemory().buffer.SetWriteFaultHandler(
+                    [this](size_t vaddr, size_t size) { HandleRasterizerWrite(vaddr, size); });
+            }
         } else {
             current_page_table->fastmem_arena = nullptr;
         }
@@ -64,6 +77,11 @@ struct Memory::Impl {
 #endif
     }
 
+    void SetCurrentPageTable(Common::PageTable& page_table) {
+        current_page_table = &page_table;
+        current_page_table->fastmem_arena = nullptr;
+    }
+
     void MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                          Common::PhysicalAddress target, Common::MemoryPermission perms,
                          bool separate_heap) {
@@ -244,6 +262,23 @@ struct Memory::Impl {
         return string;
     }
 
+    /// Returns the host pointer of an address in a page of the given type, null when unmapped
+    [[nodiscard]] u8* GetHostPointer(std::uintptr_t pointer, Common::PageType type,
+                                     u64 vaddr) const {
+        switch (type) {
+        case Common::PageType::Unmapped:
+            return nullptr;
+        case Common::PageType::Memory:
+            return reinterpret_cast<u8*>(pointer + vaddr);
+        case Common::PageType::DebugMemory:
+            return GetPointerFromDebugMemory(vaddr);
+        case Common::PageType::RasterizerCachedMemory:
+            return GetPointerFromRasterizerCachedMemory(vaddr);
+        default:
+            UNREACHABLE();
+        }
+    }
+
     bool WalkBlock(const Common::ProcessAddress addr, const std::size_t size, auto on_unmapped,
                    auto on_memory, auto on_rasterizer, auto increment) {
         const auto& page_table = *current_page_table;
@@ -258,39 +293,49 @@ struct Memory::Impl {
         }
 
         while (remaining_size) {
-            const std::size_t copy_amount =
+            std::size_t copy_amount =
                 std::min(static_cast<std::size_t>(YUZU_PAGESIZE) - page_offset, remaining_size);
             const auto current_vaddr =
                 static_cast<u64>((page_index << YUZU_PAGEBITS) + page_offset);
 
             const auto [pointer, type] = page_table.pointers[page_index].PointerType();
+            u8* const host_ptr = GetHostPointer(pointer, type, current_vaddr);
+            ++page_index;
+
+            // Extend the run over the following pages of the same type that are contiguous in
+            // host memory, so it is handled with a single call.
+            while (copy_amount < remaining_size) {
+                const auto [next_pointer, next_type] =
+                    page_table.pointers[page_index].PointerType();
+                if (next_type != type) {
+                    break;
+                }
+                const u8* const next_ptr =
+                    GetHostPointer(next_pointer, next_type, page_index << YUZU_PAGEBITS);
+                if (next_ptr != (host_ptr ? host_ptr + copy_amount : nullptr)) {
+                    break;
+                }
+                copy_amount += std::min(static_cast<std::size_t>(YUZU_PAGESIZE),
+                                        remaining_size - copy_amount);
+                ++page_index;
+            }
+
             switch (type) {
-            case Common::PageType::Unmapped: {
+            case Common::PageType::Unmapped:
                 user_accessible = false;
                 on_unmapped(copy_amount, current_vaddr);
                 break;
-            }
-            case Common::PageType::Memory: {
-                u8* mem_ptr =
-                    reinterpret_cast<u8*>(pointer + page_offset + (page_index << YUZU_PAGEBITS));
-                on_memory(copy_amount, mem_ptr);
-                break;
-            }
-            case Common::PageType::DebugMemory: {
-                u8* const mem_ptr{GetPointerFromDebugMemory(current_vaddr)};
-                on_memory(copy_amount, mem_ptr);
+            case Common::PageType::Memory:
+            case Common::PageType::DebugMemory:
+                on_memory(copy_amount, host_ptr);
                 break;
-            }
-            case Common::PageType::RasterizerCachedMemory: {
-                u8* const host_ptr{GetPointerFromRasterizerCachedMemory(current_vaddr)};
+            case Common::PageType::RasterizerCachedMemory:
                 on_rasterizer(current_vaddr, copy_amount, host_ptr);
                 break;
-            }
             default:
                 UNREACHABLE();
             }
 
-            page_index++;
             page_offset = 0;
             increment(copy_amount);
             remaining_size -= copy_amount;
@@ -800,6 +845,33 @@ struct Memory::Impl {
         return true;
     }
 
+    /// Calls operation on each run of device addresses backing a host memory range
+    template <typename Func>
+    void ApplyOpOnDeviceRanges(const u8* p, size_t size, Common::ScratchBuffer<u32>& scratch,
+                               Func&& operation) {
+        DAddr run_address{};
+        size_t run_size{};
+        for (size_t offset = 0; offset < size;) {
+            const size_t page_offset = reinterpret_cast<uintptr_t>(p + offset) & YUZU_PAGEMASK;
+            const size_t page_size = std::min<size_t>(YUZU_PAGESIZE - page_offset, size - offset);
+            gpu_device_memory->ApplyOpOnPointer(p + offset, scratch, [&](DAddr address) {
+                if (run_size != 0 && run_address + run_size == address) {
+                    run_size += page_size;
+                    return;
+                }
+                if (run_size != 0) {
+                    operation(run_address, run_size);
+                }
+                run_address = address;
+                run_size = page_size;
+            });
+            offset += page_size;
+        }
+        if (run_size != 0) {
+            operation(run_address, run_size);
+        }
+    }
+
     void HandleRasterizerDownload(VAddr v_address, size_t size) {
         const auto* p = GetPointerImpl(
             v_address, []() {}, []() {});
@@ -808,13 +880,13 @@ struct Memory::Impl {
         }
         const size_t core = system.GetCurrentHostThreadID();
         auto& current_area = rasterizer_read_areas[core];
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
-            const DAddr end_address = address + size;
+        ApplyOpOnDeviceRanges(p, size, scratch_buffers[core], [&](DAddr address, size_t run_size) {
+            const DAddr end_address = address + run_size;
             if (current_area.start_address <= address && end_address <= current_area.end_address)
                 [[likely]] {
                 return;
             }
-            current_area = system.GPU().OnCPURead(address, size);
+            current_area = system.GPU().OnCPURead(address, run_size);
         });
     }
 
@@ -836,18 +908,20 @@ struct Memory::Impl {
                 sys_core_guard.unlock();
             }
         };
-        gpu_device_memory->ApplyOpOnPointer(p, scratch_buffers[core], [&](DAddr address) {
+        ApplyOpOnDeviceRanges(p, size, scratch_buffers[core], [&](DAddr address, size_t run_size) {
             auto& current_area = rasterizer_write_areas[core];
-            PAddr subaddress = address >> YUZU_PAGEBITS;
-            bool do_collection = current_area.last_address == subaddress;
+            const PAddr subaddress = address >> YUZU_PAGEBITS;
+            const PAddr last_subaddress = (address + run_size - 1) >> YUZU_PAGEBITS;
+            bool do_collection =
+                subaddress == last_subaddress && current_area.last_address == subaddress;
             if (!do_collection) [[unlikely]] {
-                do_collection = system.GPU().OnCPUWrite(address, size);
+                do_collection = system.GPU().OnCPUWrite(address, run_size);
                 if (!do_collection) {
                     return;
                 }
-                current_area.last_address = subaddress;
+                current_area.last_address = last_subaddress;
             }
-            gpu_dirty_managers[core].Collect(address, size);
+            gpu_dirty_managers[core].Collect(address, run_size);
         });
     }
 
@@ -885,6 +959,7 @@ struct Memory::Impl {
     std::array<Common::ScratchBuffer<u32>, Core::Hardware::NUM_CPU_CORES> scratch_buffers{};
     std::span<Core::GPUDirtyMemoryManager> gpu_dirty_managers;
     std::mutex sys_core_guard;
+    bool write_faults_handled{};
 
     std::optional<Common::HeapTracker> heap_tracker;
 #ifdef __linux__
@@ -908,6 +983,10 @@ void Memory::SetCurrentPageTable(Kernel::KProcess& process) {
     impl->SetCurrentPageTable(process);
 }
 
+void Memory::SetCurrentPageTable(Common::PageTable& page_table) {
+    impl->SetCurrentPageTable(page_table);
+}
+
 void Memory::MapMemoryRegion(Common::PageTable& page_table, Common::ProcessAddress base, u64 size,
                              Common::PhysicalAddress target, Common::MemoryPermission perms,
                              bool separate_heap) {
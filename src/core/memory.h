@@ -76,6 +76,14 @@ public:
      */
     void SetCurrentPageTable(Kernel::KProcess& process);
 
+    /**
+     * Changes the currently active page table to one that is not owned by a process.
+     * Fastmem is not used for accesses through this page table.
+     *
+     * @param page_table The page table to use.
+     */
+    void SetCurrentPageTable(Common::PageTable& page_table);
+
     /**
      * Maps an allocated buffer onto a region of the emulated process address space.
      *
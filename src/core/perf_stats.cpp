@@ -77,6 +77,14 @@ void PerfStats::EndGameFrame() {
     game_frames.fetch_add(1, std::memory_order_relaxed);
 }
 
+void PerfStats::AddPresentLatency(Clock::duration latency) {
+    std::scoped_lock lock{object_mutex};
+
+    accumulated_present_latency += latency;
+    max_present_latency = std::max(max_present_latency, latency);
+    present_latency_frames += 1;
+}
+
 double PerfStats::GetMeanFrametime() const {
     std::scoped_lock lock{object_mutex};
 
@@ -105,6 +113,11 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .present_latency = present_latency_frames == 0
+                               ? 0.0
+                               : duration_cast<DoubleSecs>(accumulated_present_latency).count() /
+                                     static_cast<double>(present_latency_frames),
+        .max_present_latency = duration_cast<DoubleSecs>(max_present_latency).count(),
     };
 
     // Reset counters
@@ -113,6 +126,9 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
+    accumulated_present_latency = Clock::duration::zero();
+    max_present_latency = Clock::duration::zero();
+    present_latency_frames = 0;
     previous_fps = current_fps;
 
     return results;
@@ -21,6 +21,10 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Average time from a frame being queued for presentation to it being displayed, in seconds
+    double present_latency;
+    /// Highest present latency since the last reset, in seconds
+    double max_present_latency;
 };
 
 /**
@@ -37,6 +41,7 @@ public:
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
+    void AddPresentLatency(Clock::duration latency);
 
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
@@ -74,6 +79,13 @@ private:
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
 
+    /// Cumulative present latency of frames displayed since last reset
+    Clock::duration accumulated_present_latency = Clock::duration::zero();
+    /// Highest present latency of a frame displayed since last reset
+    Clock::duration max_present_latency = Clock::duration::zero();
+    /// Cumulative number of frames with a measured present latency since last reset
+    u32 present_latency_frames = 0;
+
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
     /// Point when the current system frame began
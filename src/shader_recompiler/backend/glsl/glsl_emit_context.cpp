@@ -271,7 +271,9 @@ EmitContext::EmitContext(IR::Program& program, Bindings& bindings, const Profile
                          const RuntimeInfo& runtime_info_)
     : info{program.info}, profile{profile_}, runtime_info{runtime_info_}, stage{program.stage},
       uses_geometry_passthrough{program.is_geometry_passthrough &&
-                                profile.support_geometry_shader_passthrough} {
+                                profile.support_geometry_shader_passthrough},
+      uses_bindless_textures{profile.support_gl_bindless_texture && stage != Stage::Compute &&
+                             !info.texture_descriptors.empty()} {
     if (profile.need_fastmath_off) {
         header += "#pragma optionNV(fastmath off)\n";
     }
@@ -424,6 +426,9 @@ void EmitContext::SetupExtensions() {
     if (uses_geometry_passthrough) {
         header += "#extension GL_NV_geometry_shader_passthrough : enable\n";
     }
+    if (uses_bindless_textures) {
+        header += "#extension GL_ARB_bindless_texture : require\n";
+    }
 }
 
 void EmitContext::DefineConstantBuffers(Bindings& bindings) {
@@ -688,6 +693,10 @@ void EmitContext::SetupTextures(Bindings& bindings) {
         bindings.texture += desc.count;
     }
     textures.reserve(info.texture_descriptors.size());
+    if (uses_bindless_textures) {
+        SetupBindlessTextures(bindings);
+        return;
+    }
     for (const auto& desc : info.texture_descriptors) {
         textures.push_back({bindings.texture, desc.count});
         const auto sampler_type{desc.is_depth ? DepthSamplerType(desc.type)
@@ -699,6 +708,28 @@ void EmitContext::SetupTextures(Bindings& bindings) {
     }
 }
 
+void EmitContext::SetupBindlessTextures(const Bindings& bindings) {
+    // Texture handles are read from a uniform block instead of texture units, so they don't
+    // consume texture bindings. Every handle takes a 16 byte slot to keep the std140 layout
+    // uniform between single handles and arrays of handles.
+    const u32 binding{profile.gl_bindless_texture_binding + static_cast<u32>(stage)};
+    header += fmt::format("layout(std140,binding={}) uniform bindless_textures{{", binding);
+    u32 name_index{bindings.texture};
+    for (const auto& desc : info.texture_descriptors) {
+        textures.push_back({name_index, desc.count});
+        const auto sampler_type{desc.is_depth ? DepthSamplerType(desc.type)
+                                              : ColorSamplerType(desc.type, desc.is_multisample)};
+        if (desc.count > 1) {
+            header += fmt::format("{} tex{}[{}];", sampler_type, name_index, desc.count);
+        } else {
+            header += fmt::format("{} tex{};uvec2 tex{}_pad;", sampler_type, name_index,
+                                  name_index);
+        }
+        name_index += desc.count;
+    }
+    header += "};";
+}
+
 void EmitContext::DefineConstants() {
     if (info.uses_fswzadd) {
         header += "const float FSWZ_A[]=float[4](-1.f,1.f,-1.f,0.f);"
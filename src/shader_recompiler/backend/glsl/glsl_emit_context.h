@@ -157,6 +157,7 @@ public:
     bool uses_y_direction{};
     bool uses_cc_carry{};
     bool uses_geometry_passthrough{};
+    bool uses_bindless_textures{};
 
 private:
     void SetupExtensions();
@@ -169,6 +170,7 @@ private:
     std::string DefineGlobalMemoryFunctions();
     void SetupImages(Bindings& bindings);
     void SetupTextures(Bindings& bindings);
+    void SetupBindlessTextures(const Bindings& bindings);
 };
 
 } // namespace Shader::Backend::GLSL
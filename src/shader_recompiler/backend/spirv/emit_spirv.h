@@ -30,6 +30,19 @@ constexpr u32 RESCALING_LAYOUT_WORDS_OFFSET = offsetof(RescalingLayout, rescalin
 constexpr u32 RESCALING_LAYOUT_DOWN_FACTOR_OFFSET = offsetof(RescalingLayout, down_factor);
 constexpr u32 RENDERAREA_LAYOUT_OFFSET = offsetof(RenderAreaLayout, render_area);
 
+/// First binding of each kind of resource of a stage
+struct StageBindings {
+    u32 uniform_buffer{};
+    u32 storage_buffer{};
+    u32 texture_buffer{};
+    u32 image_buffer{};
+    u32 texture{};
+    u32 image{};
+};
+
+/// Assigns the bindings of the resources of a stage and advances bindings past them
+StageBindings AssignBindings(const Profile& profile, const Info& info, Bindings& bindings);
+
 [[nodiscard]] std::vector<u32> EmitSPIRV(const Profile& profile, const RuntimeInfo& runtime_info,
                                          IR::Program& program, Bindings& bindings);
 
@@ -442,6 +442,40 @@ Id DescType(EmitContext& ctx, Id sampled_type, Id pointer_type, u32 count) {
 }
 } // Anonymous namespace
 
+StageBindings AssignBindings(const Profile& profile, const Info& info, Bindings& bindings) {
+    const bool is_unified{profile.unified_descriptor_binding};
+    u32& uniform_binding{is_unified ? bindings.unified : bindings.uniform_buffer};
+    u32& storage_binding{is_unified ? bindings.unified : bindings.storage_buffer};
+    u32& texture_binding{is_unified ? bindings.unified : bindings.texture};
+    u32& image_binding{is_unified ? bindings.unified : bindings.image};
+
+    StageBindings stage_bindings;
+    stage_bindings.uniform_buffer = uniform_binding;
+    if (profile.support_descriptor_aliasing) {
+        uniform_binding += static_cast<u32>(info.constant_buffer_descriptors.size());
+    } else {
+        for (const ConstantBufferDescriptor& desc : info.constant_buffer_descriptors) {
+            uniform_binding += desc.count;
+        }
+    }
+    stage_bindings.storage_buffer = storage_binding;
+    for (const StorageBufferDescriptor& desc : info.storage_buffers_descriptors) {
+        storage_binding += desc.count;
+    }
+    stage_bindings.texture_buffer = texture_binding;
+    texture_binding += static_cast<u32>(info.texture_buffer_descriptors.size());
+    stage_bindings.image_buffer = image_binding;
+    image_binding += static_cast<u32>(info.image_buffer_descriptors.size());
+    stage_bindings.texture = texture_binding;
+    texture_binding += static_cast<u32>(info.texture_descriptors.size());
+    stage_bindings.image = image_binding;
+    image_binding += static_cast<u32>(info.image_descriptors.size());
+
+    bindings.texture_scaling_index += static_cast<u32>(info.texture_descriptors.size());
+    bindings.image_scaling_index += static_cast<u32>(info.image_descriptors.size());
+    return stage_bindings;
+}
+
 void VectorTypes::Define(Sirit::Module& sirit_ctx, Id base_type, std::string_view name) {
     defs[0] = sirit_ctx.Name(base_type, name);
 
@@ -460,11 +494,7 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     : Sirit::Module(profile_.supported_spirv), profile{profile_}, runtime_info{runtime_info_},
       stage{program.stage}, texture_rescaling_index{bindings.texture_scaling_index},
       image_rescaling_index{bindings.image_scaling_index} {
-    const bool is_unified{profile.unified_descriptor_binding};
-    u32& uniform_binding{is_unified ? bindings.unified : bindings.uniform_buffer};
-    u32& storage_binding{is_unified ? bindings.unified : bindings.storage_buffer};
-    u32& texture_binding{is_unified ? bindings.unified : bindings.texture};
-    u32& image_binding{is_unified ? bindings.unified : bindings.image};
+    const StageBindings stage_bindings{AssignBindings(profile, program.info, bindings)};
     AddCapability(spv::Capability::Shader);
     DefineCommonTypes(program.info);
     DefineCommonConstants();
@@ -472,13 +502,13 @@ EmitContext::EmitContext(const Profile& profile_, const RuntimeInfo& runtime_inf
     DefineLocalMemory(program);
     DefineSharedMemory(program);
     DefineSharedMemoryFunctions(program);
-    DefineConstantBuffers(program.info, uniform_binding);
+    DefineConstantBuffers(program.info, stage_bindings.uniform_buffer);
     DefineConstantBufferIndirectFunctions(program.info);
-    DefineStorageBuffers(program.info, storage_binding);
-    DefineTextureBuffers(program.info, texture_binding);
-    DefineImageBuffers(program.info, image_binding);
-    DefineTextures(program.info, texture_binding, bindings.texture_scaling_index);
-    DefineImages(program.info, image_binding, bindings.image_scaling_index);
+    DefineStorageBuffers(program.info, stage_bindings.storage_buffer);
+    DefineTextureBuffers(program.info, stage_bindings.texture_buffer);
+    DefineImageBuffers(program.info, stage_bindings.image_buffer);
+    DefineTextures(program.info, stage_bindings.texture);
+    DefineImages(program.info, stage_bindings.image);
     DefineAttributeMemAccess(program.info);
     DefineWriteStorageCasLoopFunction(program.info);
     DefineGlobalMemoryFunctions(program.info);
@@ -1106,16 +1136,13 @@ void EmitContext::DefineRenderArea(const Info& info) {
     }
 }
 
-void EmitContext::DefineConstantBuffers(const Info& info, u32& binding) {
+void EmitContext::DefineConstantBuffers(const Info& info, u32 binding) {
     if (info.constant_buffer_descriptors.empty()) {
         return;
     }
     if (!profile.support_descriptor_aliasing) {
         DefineConstBuffers(*this, info, &UniformDefinitions::U32x4, binding, U32[4], 'u',
                            sizeof(u32[4]));
-        for (const ConstantBufferDescriptor& desc : info.constant_buffer_descriptors) {
-            binding += desc.count;
-        }
         return;
     }
     IR::Type types{info.used_constant_buffer_types | info.used_indirect_cbuf_types};
@@ -1149,7 +1176,6 @@ void EmitContext::DefineConstantBuffers(const Info& info, u32& binding) {
         DefineConstBuffers(*this, info, &UniformDefinitions::U32x2, binding, U32[2], 'u',
                            sizeof(u32[2]));
     }
-    binding += static_cast<u32>(info.constant_buffer_descriptors.size());
 }
 
 void EmitContext::DefineConstantBufferIndirectFunctions(const Info& info) {
@@ -1209,7 +1235,7 @@ void EmitContext::DefineConstantBufferIndirectFunctions(const Info& info) {
     }
 }
 
-void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
+void EmitContext::DefineStorageBuffers(const Info& info, u32 binding) {
     if (info.storage_buffers_descriptors.empty()) {
         return;
     }
@@ -1249,9 +1275,6 @@ void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
         DefineSsbos(*this, storage_types.U32x4, &StorageDefinitions::U32x4, info, binding, U32[4],
                     sizeof(u32[4]));
     }
-    for (const StorageBufferDescriptor& desc : info.storage_buffers_descriptors) {
-        binding += desc.count;
-    }
     const bool needs_function{
         info.uses_global_increment || info.uses_global_decrement || info.uses_atomic_f32_add ||
         info.uses_atomic_f16x2_add || info.uses_atomic_f16x2_min || info.uses_atomic_f16x2_max ||
@@ -1297,7 +1320,7 @@ void EmitContext::DefineStorageBuffers(const Info& info, u32& binding) {
     }
 }
 
-void EmitContext::DefineTextureBuffers(const Info& info, u32& binding) {
+void EmitContext::DefineTextureBuffers(const Info& info, u32 binding) {
     if (info.texture_buffer_descriptors.empty()) {
         return;
     }
@@ -1325,7 +1348,7 @@ void EmitContext::DefineTextureBuffers(const Info& info, u32& binding) {
     }
 }
 
-void EmitContext::DefineImageBuffers(const Info& info, u32& binding) {
+void EmitContext::DefineImageBuffers(const Info& info, u32 binding) {
     image_buffers.reserve(info.image_buffer_descriptors.size());
     for (const ImageBufferDescriptor& desc : info.image_buffer_descriptors) {
         if (desc.count != 1) {
@@ -1353,7 +1376,7 @@ void EmitContext::DefineImageBuffers(const Info& info, u32& binding) {
     }
 }
 
-void EmitContext::DefineTextures(const Info& info, u32& binding, u32& scaling_index) {
+void EmitContext::DefineTextures(const Info& info, u32 binding) {
     textures.reserve(info.texture_descriptors.size());
     for (const TextureDescriptor& desc : info.texture_descriptors) {
         const Id image_type{ImageType(*this, desc)};
@@ -1376,14 +1399,13 @@ void EmitContext::DefineTextures(const Info& info, u32& binding, u32& scaling_in
             interfaces.push_back(id);
         }
         ++binding;
-        ++scaling_index;
     }
     if (info.uses_atomic_image_u32) {
         image_u32 = TypePointer(spv::StorageClass::Image, U32[1]);
     }
 }
 
-void EmitContext::DefineImages(const Info& info, u32& binding, u32& scaling_index) {
+void EmitContext::DefineImages(const Info& info, u32 binding) {
     images.reserve(info.image_descriptors.size());
     for (const ImageDescriptor& desc : info.image_descriptors) {
         if (desc.count != 1) {
@@ -1406,7 +1428,6 @@ void EmitContext::DefineImages(const Info& info, u32& binding, u32& scaling_inde
             interfaces.push_back(id);
         }
         ++binding;
-        ++scaling_index;
     }
 }
 
@@ -366,13 +366,13 @@ private:
     void DefineLocalMemory(const IR::Program& program);
     void DefineSharedMemory(const IR::Program& program);
     void DefineSharedMemoryFunctions(const IR::Program& program);
-    void DefineConstantBuffers(const Info& info, u32& binding);
+    void DefineConstantBuffers(const Info& info, u32 binding);
     void DefineConstantBufferIndirectFunctions(const Info& info);
-    void DefineStorageBuffers(const Info& info, u32& binding);
-    void DefineTextureBuffers(const Info& info, u32& binding);
-    void DefineImageBuffers(const Info& info, u32& binding);
-    void DefineTextures(const Info& info, u32& binding, u32& scaling_index);
-    void DefineImages(const Info& info, u32& binding, u32& scaling_index);
+    void DefineStorageBuffers(const Info& info, u32 binding);
+    void DefineTextureBuffers(const Info& info, u32 binding);
+    void DefineImageBuffers(const Info& info, u32 binding);
+    void DefineTextures(const Info& info, u32 binding);
+    void DefineImages(const Info& info, u32 binding);
     void DefineAttributeMemAccess(const Info& info);
     void DefineWriteStorageCasLoopFunction(const Info& info);
     void DefineGlobalMemoryFunctions(const Info& info);
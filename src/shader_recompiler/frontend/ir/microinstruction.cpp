@@ -246,6 +246,120 @@ bool Inst::IsPseudoInstruction() const noexcept {
     }
 }
 
+bool Inst::IsPure() const noexcept {
+    if (MayHaveSideEffects() || IsPseudoInstruction() || HasAssociatedPseudoOperation()) {
+        return false;
+    }
+    switch (op) {
+    // Values that are not SSA yet or that may be written by the shader itself
+    case Opcode::Phi:
+    case Opcode::Identity:
+    case Opcode::Void:
+    case Opcode::GetRegister:
+    case Opcode::GetPred:
+    case Opcode::GetGotoVariable:
+    case Opcode::GetIndirectBranchVariable:
+    case Opcode::GetAttribute:
+    case Opcode::GetAttributeU32:
+    case Opcode::GetAttributeIndexed:
+    case Opcode::GetPatch:
+    case Opcode::GetZFlag:
+    case Opcode::GetSFlag:
+    case Opcode::GetCFlag:
+    case Opcode::GetOFlag:
+    // Values that depend on the state of the invocation
+    case Opcode::InvocationInfo:
+    case Opcode::SampleId:
+    case Opcode::IsHelperInvocation:
+    // Undefined values are not guaranteed to be the same
+    case Opcode::UndefU1:
+    case Opcode::UndefU8:
+    case Opcode::UndefU16:
+    case Opcode::UndefU32:
+    case Opcode::UndefU64:
+    // Memory that can be modified
+    case Opcode::LoadGlobalU8:
+    case Opcode::LoadGlobalS8:
+    case Opcode::LoadGlobalU16:
+    case Opcode::LoadGlobalS16:
+    case Opcode::LoadGlobal32:
+    case Opcode::LoadGlobal64:
+    case Opcode::LoadGlobal128:
+    case Opcode::LoadStorageU8:
+    case Opcode::LoadStorageS8:
+    case Opcode::LoadStorageU16:
+    case Opcode::LoadStorageS16:
+    case Opcode::LoadStorage32:
+    case Opcode::LoadStorage64:
+    case Opcode::LoadStorage128:
+    case Opcode::LoadLocal:
+    case Opcode::LoadSharedU8:
+    case Opcode::LoadSharedS8:
+    case Opcode::LoadSharedU16:
+    case Opcode::LoadSharedS16:
+    case Opcode::LoadSharedU32:
+    case Opcode::LoadSharedU64:
+    case Opcode::LoadSharedU128:
+    // Texture reads may have implicit derivatives or read written images
+    case Opcode::BindlessImageSampleImplicitLod:
+    case Opcode::BindlessImageSampleExplicitLod:
+    case Opcode::BindlessImageSampleDrefImplicitLod:
+    case Opcode::BindlessImageSampleDrefExplicitLod:
+    case Opcode::BindlessImageGather:
+    case Opcode::BindlessImageGatherDref:
+    case Opcode::BindlessImageFetch:
+    case Opcode::BindlessImageQueryDimensions:
+    case Opcode::BindlessImageQueryLod:
+    case Opcode::BindlessImageGradient:
+    case Opcode::BindlessImageRead:
+    case Opcode::BoundImageSampleImplicitLod:
+    case Opcode::BoundImageSampleExplicitLod:
+    case Opcode::BoundImageSampleDrefImplicitLod:
+    case Opcode::BoundImageSampleDrefExplicitLod:
+    case Opcode::BoundImageGather:
+    case Opcode::BoundImageGatherDref:
+    case Opcode::BoundImageFetch:
+    case Opcode::BoundImageQueryDimensions:
+    case Opcode::BoundImageQueryLod:
+    case Opcode::BoundImageGradient:
+    case Opcode::BoundImageRead:
+    case Opcode::ImageSampleImplicitLod:
+    case Opcode::ImageSampleExplicitLod:
+    case Opcode::ImageSampleDrefImplicitLod:
+    case Opcode::ImageSampleDrefExplicitLod:
+    case Opcode::ImageGather:
+    case Opcode::ImageGatherDref:
+    case Opcode::ImageFetch:
+    case Opcode::ImageQueryDimensions:
+    case Opcode::ImageQueryLod:
+    case Opcode::ImageGradient:
+    case Opcode::ImageRead:
+    // Subgroup operations depend on the active invocations
+    case Opcode::LaneId:
+    case Opcode::VoteAll:
+    case Opcode::VoteAny:
+    case Opcode::VoteEqual:
+    case Opcode::SubgroupBallot:
+    case Opcode::SubgroupEqMask:
+    case Opcode::SubgroupLtMask:
+    case Opcode::SubgroupLeMask:
+    case Opcode::SubgroupGtMask:
+    case Opcode::SubgroupGeMask:
+    case Opcode::ShuffleIndex:
+    case Opcode::ShuffleUp:
+    case Opcode::ShuffleDown:
+    case Opcode::ShuffleButterfly:
+    case Opcode::FSwizzleAdd:
+    case Opcode::DPdxFine:
+    case Opcode::DPdyFine:
+    case Opcode::DPdxCoarse:
+    case Opcode::DPdyCoarse:
+        return false;
+    default:
+        return true;
+    }
+}
+
 bool Inst::AreAllArgsImmediates() const {
     if (op == Opcode::Phi) {
         throw LogicError("Testing for all arguments are immediates on phi instruction");
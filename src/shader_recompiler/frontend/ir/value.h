@@ -148,6 +148,10 @@ public:
     /// Pseudo-instructions depend on their parent instructions for their semantics.
     [[nodiscard]] bool IsPseudoInstruction() const noexcept;
 
+    /// Determines whether or not this instruction is pure.
+    /// Pure instructions only depend on their arguments, so they can be deduplicated and moved.
+    [[nodiscard]] bool IsPure() const noexcept;
+
     /// Determines if all arguments of this instruction are immediates.
     [[nodiscard]] bool AreAllArgsImmediates() const;
 
@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/logging/log.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t MAX_ARGS{5};
+
+struct Expression {
+    IR::Opcode opcode{};
+    u32 flags{};
+    size_t num_args{};
+    std::array<IR::Value, MAX_ARGS> args{};
+    size_t hash{};
+
+    [[nodiscard]] bool operator==(const Expression& other) const {
+        return opcode == other.opcode && flags == other.flags && num_args == other.num_args &&
+               std::equal(args.begin(), args.begin() + num_args, other.args.begin());
+    }
+};
+
+[[nodiscard]] size_t HashCombine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+[[nodiscard]] size_t HashValue(const IR::Value& value) {
+    if (!value.IsImmediate()) {
+        return std::hash<const IR::Inst*>{}(value.InstRecursive());
+    }
+    const IR::Value resolved{value.Resolve()};
+    const size_t type{static_cast<size_t>(resolved.Type())};
+    switch (resolved.Type()) {
+    case IR::Type::Void:
+        return type;
+    case IR::Type::Reg:
+        return HashCombine(type, static_cast<size_t>(resolved.Reg()));
+    case IR::Type::Pred:
+        return HashCombine(type, static_cast<size_t>(resolved.Pred()));
+    case IR::Type::Attribute:
+        return HashCombine(type, static_cast<size_t>(resolved.Attribute()));
+    case IR::Type::Patch:
+        return HashCombine(type, static_cast<size_t>(resolved.Patch()));
+    case IR::Type::U1:
+        return HashCombine(type, resolved.U1() ? 1 : 0);
+    case IR::Type::U8:
+        return HashCombine(type, resolved.U8());
+    case IR::Type::U16:
+        return HashCombine(type, resolved.U16());
+    case IR::Type::U32:
+        return HashCombine(type, resolved.U32());
+    case IR::Type::F32:
+        return HashCombine(type, Common::BitCast<u32>(resolved.F32()));
+    case IR::Type::U64:
+        return HashCombine(type, static_cast<size_t>(resolved.U64()));
+    case IR::Type::F64:
+        return HashCombine(type, static_cast<size_t>(Common::BitCast<u64>(resolved.F64())));
+    default:
+        throw NotImplementedException("Hashing immediate of type {}", resolved.Type());
+    }
+}
+
+[[nodiscard]] bool IsCommutative(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalXor:
+        return true;
+    default:
+        return false;
+    }
+}
+
+[[nodiscard]] Expression MakeExpression(const IR::Inst& inst) {
+    Expression expr{
+        .opcode = inst.GetOpcode(),
+        .flags = inst.Flags<u32>(),
+        .num_args = inst.NumArgs(),
+    };
+    if (expr.num_args > MAX_ARGS) {
+        throw LogicError("Too many arguments {} in opcode {}", expr.num_args, expr.opcode);
+    }
+    std::array<size_t, MAX_ARGS> arg_hashes{};
+    for (size_t i = 0; i < expr.num_args; ++i) {
+        expr.args[i] = inst.Arg(i).Resolve();
+        arg_hashes[i] = HashValue(expr.args[i]);
+    }
+    if (IsCommutative(expr.opcode) && arg_hashes[0] > arg_hashes[1]) {
+        // Canonicalize the operand order so a + b and b + a share a value number
+        std::swap(expr.args[0], expr.args[1]);
+        std::swap(arg_hashes[0], arg_hashes[1]);
+    }
+    expr.hash = HashCombine(static_cast<size_t>(expr.opcode), expr.flags);
+    for (size_t i = 0; i < expr.num_args; ++i) {
+        expr.hash = HashCombine(expr.hash, arg_hashes[i]);
+    }
+    return expr;
+}
+
+struct DominatorTree {
+    std::unordered_map<const IR::Block*, std::vector<IR::Block*>> children;
+    IR::Block* root{};
+};
+
+DominatorTree BuildDominatorTree(const IR::Program& program) {
+    // "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy
+    const IR::BlockList& post_order{program.post_order_blocks};
+    std::unordered_map<const IR::Block*, size_t> post_order_index;
+    post_order_index.reserve(post_order.size());
+    for (size_t index = 0; index < post_order.size(); ++index) {
+        post_order_index.emplace(post_order[index], index);
+    }
+    constexpr size_t UNDEFINED{~size_t{0}};
+    std::vector<size_t> idom(post_order.size(), UNDEFINED);
+    const size_t root_index{post_order.size() - 1};
+    idom[root_index] = root_index;
+
+    const auto intersect{[&](size_t lhs, size_t rhs) {
+        while (lhs != rhs) {
+            while (lhs < rhs) {
+                lhs = idom[lhs];
+            }
+            while (rhs < lhs) {
+                rhs = idom[rhs];
+            }
+        }
+        return lhs;
+    }};
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        for (size_t index = root_index; index-- > 0;) {
+            size_t new_idom{UNDEFINED};
+            for (const IR::Block* const pred : post_order[index]->ImmPredecessors()) {
+                const auto it{post_order_index.find(pred)};
+                if (it == post_order_index.end() || idom[it->second] == UNDEFINED) {
+                    // Unreachable or not yet processed predecessor
+                    continue;
+                }
+                new_idom = new_idom == UNDEFINED ? it->second : intersect(it->second, new_idom);
+            }
+            if (new_idom != UNDEFINED && idom[index] != new_idom) {
+                idom[index] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    DominatorTree tree;
+    tree.root = post_order[root_index];
+    for (size_t index = root_index; index-- > 0;) {
+        if (idom[index] != UNDEFINED) {
+            tree.children[post_order[idom[index]]].push_back(post_order[index]);
+        }
+    }
+    return tree;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    if (program.post_order_blocks.empty()) {
+        return;
+    }
+    const DominatorTree tree{BuildDominatorTree(program)};
+
+    // Expressions available in the dominators of the block being visited, bucketed by hash
+    std::unordered_map<size_t, std::vector<std::pair<Expression, IR::Inst*>>> available;
+    std::vector<size_t> scope_log;
+
+    struct Frame {
+        IR::Block* block;
+        size_t child_index;
+        size_t scope_begin;
+    };
+    std::vector<Frame> stack;
+    size_t num_removed{};
+
+    const auto visit_block{[&](IR::Block* block) {
+        stack.push_back(Frame{block, 0, scope_log.size()});
+        for (IR::Inst& inst : block->Instructions()) {
+            if (!inst.IsPure()) {
+                continue;
+            }
+            Expression expr{MakeExpression(inst)};
+            auto& bucket{available[expr.hash]};
+            const auto it{
+                std::ranges::find(bucket, expr, &std::pair<Expression, IR::Inst*>::first)};
+            if (it != bucket.end()) {
+                inst.ReplaceUsesWith(IR::Value{it->second});
+                ++num_removed;
+                continue;
+            }
+            const size_t hash{expr.hash};
+            bucket.emplace_back(std::move(expr), &inst);
+            scope_log.push_back(hash);
+        }
+    }};
+    visit_block(tree.root);
+    while (!stack.empty()) {
+        Frame& frame{stack.back()};
+        const auto it{tree.children.find(frame.block)};
+        if (it != tree.children.end() && frame.child_index < it->second.size()) {
+            IR::Block* const child{it->second[frame.child_index++]};
+            visit_block(child);
+            continue;
+        }
+        // Leaving the dominator subtree, expressions defined in it are no longer available
+        while (scope_log.size() > frame.scope_begin) {
+            available[scope_log.back()].pop_back();
+            scope_log.pop_back();
+        }
+        stack.pop_back();
+    }
+    if (num_removed > 0) {
+        LOG_DEBUG(Shader, "Global value numbering removed {} redundant instructions",
+                  num_removed);
+    }
+}
+
+} // namespace Shader::Optimization
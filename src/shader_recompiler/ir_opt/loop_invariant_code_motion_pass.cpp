@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "common/logging/log.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+struct Loop {
+    IR::Block* header{};
+    IR::Block* continue_block{};
+    std::vector<IR::Block*> blocks;
+};
+
+/// Returns the loops in the program, inner loops are returned before their outer loops
+std::vector<Loop> CollectLoops(const IR::Program& program) {
+    std::vector<Loop> loops;
+    std::vector<Loop> open_loops;
+    const IR::AbstractSyntaxList& syntax_list{program.syntax_list};
+    for (size_t index = 0; index < syntax_list.size(); ++index) {
+        const IR::AbstractSyntaxNode& node{syntax_list[index]};
+        switch (node.type) {
+        case IR::AbstractSyntaxNode::Type::Block:
+            for (Loop& loop : open_loops) {
+                loop.blocks.push_back(node.data.block);
+            }
+            break;
+        case IR::AbstractSyntaxNode::Type::Loop: {
+            // The loop header is always emitted right before the loop node
+            IR::Block* const header{syntax_list.at(index - 1).data.block};
+            open_loops.push_back(Loop{
+                .header = header,
+                .continue_block = node.data.loop.continue_block,
+                .blocks = {header},
+            });
+            break;
+        }
+        case IR::AbstractSyntaxNode::Type::Repeat:
+            loops.push_back(std::move(open_loops.back()));
+            open_loops.pop_back();
+            break;
+        default:
+            break;
+        }
+    }
+    return loops;
+}
+
+/// Returns the block that unconditionally enters the loop once per loop execution, if any
+IR::Block* FindPreheader(const Loop& loop) {
+    IR::Block* preheader{};
+    for (IR::Block* const pred : loop.header->ImmPredecessors()) {
+        if (pred == loop.continue_block) {
+            continue;
+        }
+        if (preheader) {
+            return nullptr;
+        }
+        preheader = pred;
+    }
+    if (!preheader || preheader->ImmSuccessors().size() != 1) {
+        return nullptr;
+    }
+    return preheader;
+}
+
+size_t HoistLoop(const Loop& loop, const std::unordered_set<const IR::Block*>& reachable) {
+    IR::Block* const preheader{FindPreheader(loop)};
+    if (!preheader || !reachable.contains(preheader)) {
+        return 0;
+    }
+    if (std::ranges::any_of(loop.blocks,
+                            [&](const IR::Block* block) { return !reachable.contains(block); })) {
+        return 0;
+    }
+    std::unordered_set<const IR::Inst*> defined_in_loop;
+    for (IR::Block* const block : loop.blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            defined_in_loop.insert(&inst);
+        }
+    }
+    const auto is_invariant{[&](const IR::Inst& inst) {
+        const size_t num_args{inst.NumArgs()};
+        for (size_t i = 0; i < num_args; ++i) {
+            const IR::Value arg{inst.Arg(i)};
+            if (!arg.IsImmediate() && defined_in_loop.contains(arg.InstRecursive())) {
+                return false;
+            }
+        }
+        return true;
+    }};
+    size_t num_hoisted{};
+    bool progress{true};
+    while (progress) {
+        progress = false;
+        for (IR::Block* const block : loop.blocks) {
+            for (auto it = block->begin(); it != block->end();) {
+                IR::Inst& inst{*it};
+                if (!inst.IsPure() || !is_invariant(inst)) {
+                    ++it;
+                    continue;
+                }
+                // Identities are left behind in the loop, point straight to their definitions
+                const size_t num_args{inst.NumArgs()};
+                for (size_t i = 0; i < num_args; ++i) {
+                    inst.SetArg(i, inst.Arg(i).Resolve());
+                }
+                it = block->Instructions().erase(it);
+                preheader->Instructions().push_back(inst);
+                defined_in_loop.erase(&inst);
+                ++num_hoisted;
+                progress = true;
+            }
+        }
+    }
+    return num_hoisted;
+}
+} // Anonymous namespace
+
+void LoopInvariantCodeMotionPass(IR::Program& program) {
+    const std::unordered_set<const IR::Block*> reachable(program.post_order_blocks.begin(),
+                                                         program.post_order_blocks.end());
+    size_t num_hoisted{};
+    for (const Loop& loop : CollectLoops(program)) {
+        num_hoisted += HoistLoop(loop, reachable);
+    }
+    if (num_hoisted > 0) {
+        LOG_DEBUG(Shader, "Loop invariant code motion hoisted {} instructions", num_hoisted);
+    }
+}
+
+} // namespace Shader::Optimization
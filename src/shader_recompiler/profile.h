@@ -42,6 +42,8 @@ struct Profile {
     bool support_gl_variable_aoffi{};
     bool support_gl_sparse_textures{};
     bool support_gl_derivative_control{};
+    /// Sampled textures read their handles from a uniform block (GL_ARB_bindless_texture)
+    bool support_gl_bindless_texture{};
     bool support_scaled_attributes{};
     bool support_multi_viewport{};
     bool support_geometry_streams{};
@@ -83,6 +85,8 @@ struct Profile {
     bool has_broken_spirv_subgroup_mask_vector_extract_dynamic{};
 
     u32 gl_max_compute_smem_size{};
+    /// Uniform buffer binding of the bindless texture block of the first stage, one per stage
+    u32 gl_bindless_texture_binding{};
 
     /// Maxwell and earlier nVidia architectures have broken robust support
     bool has_broken_robust{};
@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <atomic>
+#include <thread>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/host_memory.h"
@@ -184,3 +188,118 @@ TEST_CASE("HostMemory: Partial sparse middle unmap and check bindings", "[common
     REQUIRE(ptr[0x0000] == 19);
     REQUIRE(ptr[0x3fff] == 12);
 }
+
+TEST_CASE("HostMemory: Huge page backed bindings", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE, true);
+    mem.Map(0x200000, 0x400000, 0x400000, PERMS, HEAP);
+    mem.Map(0x801000, 0x400000, 0x200000, PERMS, HEAP);
+
+    volatile u8* const data = mem.BackingBasePointer();
+    volatile u8* const aligned = mem.VirtualBasePointer() + 0x200000;
+    volatile u8* const unaligned = mem.VirtualBasePointer() + 0x801000;
+    aligned[0x0000] = 19;
+    aligned[0x3fffff] = 12;
+
+    REQUIRE(data[0x400000] == 19);
+    REQUIRE(data[0x7fffff] == 12);
+    REQUIRE(unaligned[0x0000] == 19);
+}
+
+TEST_CASE("HostMemory: Write fault handler", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    mem.Map(0x4000, 0x10000, 0x4000, PERMS, HEAP);
+
+    std::atomic<size_t> faults{};
+    const bool supported = mem.SetWriteFaultHandler([&](size_t virtual_offset, size_t length) {
+        ++faults;
+        mem.Protect(virtual_offset, length, PERMS);
+    });
+    if (!supported) {
+        // Writes to read-only ranges keep faulting on this host
+        return;
+    }
+
+    mem.Protect(0x4000, 0x4000, Common::MemoryPermission::Read);
+
+    volatile u8* const data = mem.BackingBasePointer() + 0x10000;
+    volatile u8* const ptr = mem.VirtualBasePointer() + 0x4000;
+    std::thread([&] {
+        ptr[0x1008] = 19;
+        ptr[0x1009] = 12;
+    }).join();
+
+    REQUIRE(faults == 1);
+    REQUIRE(data[0x1008] == 19);
+    REQUIRE(data[0x1009] == 12);
+
+    ptr[0x0000] = 7;
+    REQUIRE(faults == 2);
+
+    mem.SetWriteFaultHandler({});
+}
+
+TEST_CASE("HostMemory: Write fault handler keeps new protection", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    mem.Map(0x4000, 0x10000, 0x4000, PERMS, HEAP);
+
+    std::atomic<size_t> faults{};
+    const bool supported = mem.SetWriteFaultHandler([&](size_t virtual_offset, size_t length) {
+        // Protecting the page again before the writer resumes has to fault the write again
+        const auto perms = ++faults == 1 ? Common::MemoryPermission::Read : PERMS;
+        mem.Protect(virtual_offset, length, perms);
+    });
+    if (!supported) {
+        return;
+    }
+
+    mem.Protect(0x4000, 0x4000, Common::MemoryPermission::Read);
+
+    volatile u8* const ptr = mem.VirtualBasePointer() + 0x4000;
+    ptr[0x0010] = 19;
+    REQUIRE(faults == 2);
+    REQUIRE(mem.BackingBasePointer()[0x10010] == 19);
+
+    mem.SetWriteFaultHandler({});
+}
+
+TEST_CASE("HostMemory: Copy-on-write snapshot", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    mem.Map(0x4000, 0x10000, 0x4000, PERMS, HEAP);
+
+    volatile u8* const data = mem.BackingBasePointer() + 0x10000;
+    volatile u8* const ptr = mem.VirtualBasePointer() + 0x4000;
+    data[0x0010] = 1;
+    data[0x1010] = 2;
+    data[0x3010] = 3;
+
+    if (!mem.BeginSnapshot()) {
+        // Snapshots are unsupported on this host
+        return;
+    }
+    REQUIRE(!mem.BeginSnapshot());
+
+    // Write through both views, and twice to the same page
+    data[0x0010] = 4;
+    ptr[0x1010] = 5;
+    ptr[0x0010] = 6;
+    REQUIRE(data[0x0010] == 6);
+    REQUIRE(data[0x1010] == 5);
+
+    std::array<u8, 0x4000> snapshot{};
+    REQUIRE(mem.ReadSnapshot(0x10000, snapshot));
+    REQUIRE(snapshot[0x0010] == 1);
+    REQUIRE(snapshot[0x1010] == 2);
+    REQUIRE(snapshot[0x3010] == 3);
+
+    // Pages mapped after the snapshot began are protected too
+    mem.Map(0x20000, 0x13000, 0x1000, PERMS, HEAP);
+    mem.VirtualBasePointer()[0x20010] = 7;
+    REQUIRE(data[0x3010] == 7);
+    REQUIRE(mem.ReadSnapshot(0x13000, std::span(snapshot).first(0x1000)));
+    REQUIRE(snapshot[0x0010] == 3);
+
+    mem.EndSnapshot();
+    REQUIRE(!mem.ReadSnapshot(0x10000, snapshot));
+    ptr[0x2010] = 8;
+    REQUIRE(data[0x2010] == 8);
+}
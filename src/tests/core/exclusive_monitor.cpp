@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "core/arm/reservation_exclusive_monitor.h"
+#include "core/device_memory.h"
+#include "core/hardware_properties.h"
+#include "core/memory.h"
+#include "tests/core/memory_fixture.h"
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+#include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
+#endif
+
+namespace {
+using Core::Memory::YUZU_PAGESIZE;
+
+constexpr u64 BASE = 0x10000000ULL;
+constexpr size_t NUM_CORES = Core::Hardware::NUM_CPU_CORES;
+constexpr u32 NUM_INCREMENTS = 100000;
+
+struct ScopeInit final : Tests::MemoryFixture {
+    ScopeInit() {
+        Map(BASE, YUZU_PAGESIZE, Core::DramMemoryMap::Base);
+    }
+};
+
+/// Every core increments the counter at BASE + core * stride, a stride of zero shares one counter
+void RunIncrements(Core::ExclusiveMonitor& monitor, u64 stride) {
+    std::array<std::jthread, NUM_CORES> threads;
+    for (size_t core = 0; core < NUM_CORES; ++core) {
+        threads[core] = std::jthread([&monitor, stride, core] {
+            const VAddr addr = BASE + core * stride;
+            for (u32 i = 0; i < NUM_INCREMENTS; ++i) {
+                u32 value;
+                do {
+                    value = monitor.ExclusiveRead32(core, addr);
+                } while (!monitor.ExclusiveWrite32(core, addr, value + 1));
+            }
+        });
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("ReservationExclusiveMonitor: Exclusive write after a conflicting write", "[core]") {
+    ScopeInit guard;
+    Core::ReservationExclusiveMonitor monitor(guard.memory, NUM_CORES);
+
+    REQUIRE(monitor.ExclusiveRead32(0, BASE) == 0);
+    REQUIRE(monitor.ExclusiveRead32(1, BASE) == 0);
+    REQUIRE(monitor.ExclusiveWrite32(1, BASE, 1));
+    REQUIRE(!monitor.ExclusiveWrite32(0, BASE, 2));
+    REQUIRE(guard.memory.Read32(BASE) == 1);
+
+    // Reservations are consumed by writes and cleared explicitly
+    REQUIRE(!monitor.ExclusiveWrite32(1, BASE, 3));
+    REQUIRE(monitor.ExclusiveRead64(0, BASE + 8) == 0);
+    monitor.ClearExclusive(0);
+    REQUIRE(!monitor.ExclusiveWrite64(0, BASE + 8, 4));
+
+    // Plain writes between the read and the write are caught by the comparison
+    REQUIRE(monitor.ExclusiveRead32(2, BASE) == 1);
+    guard.memory.Write32(BASE, 5);
+    REQUIRE(!monitor.ExclusiveWrite32(2, BASE, 6));
+    REQUIRE(guard.memory.Read32(BASE) == 5);
+}
+
+TEST_CASE("ReservationExclusiveMonitor: Concurrent increments", "[core]") {
+    ScopeInit guard;
+    Core::ReservationExclusiveMonitor monitor(guard.memory, NUM_CORES);
+
+    RunIncrements(monitor, 0);
+    REQUIRE(guard.memory.Read32(BASE) == NUM_CORES * NUM_INCREMENTS);
+
+    RunIncrements(monitor, 64);
+    for (size_t core = 0; core < NUM_CORES; ++core) {
+        const u32 expected = NUM_INCREMENTS * (core == 0 ? NUM_CORES + 1 : 1);
+        REQUIRE(guard.memory.Read32(BASE + core * 64) == expected);
+    }
+}
+
+TEST_CASE("ExclusiveMonitor: Throughput of concurrent increments", "[.][benchmark]") {
+    ScopeInit guard;
+    Core::ReservationExclusiveMonitor reservation_monitor(guard.memory, NUM_CORES);
+
+    BENCHMARK("Reservation table, shared address") {
+        RunIncrements(reservation_monitor, 0);
+    };
+    BENCHMARK("Reservation table, independent addresses") {
+        RunIncrements(reservation_monitor, 64);
+    };
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    Core::DynarmicExclusiveMonitor dynarmic_monitor(guard.memory, NUM_CORES);
+
+    BENCHMARK("Dynarmic, shared address") {
+        RunIncrements(dynarmic_monitor, 0);
+    };
+    BENCHMARK("Dynarmic, independent addresses") {
+        RunIncrements(dynarmic_monitor, 64);
+    };
+#endif
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "common/literals.h"
+#include "core/device_memory.h"
+#include "core/memory.h"
+#include "tests/core/memory_fixture.h"
+
+namespace {
+using namespace Common::Literals;
+using Core::Memory::YUZU_PAGESIZE;
+using ScopeInit = Tests::MemoryFixture;
+
+constexpr u64 BASE = 0x10000000ULL;
+constexpr u64 TARGET = Core::DramMemoryMap::Base + 0x1000000ULL;
+constexpr size_t BLOCK_SIZE = 4_MiB;
+
+std::vector<u8> MakePattern(size_t size) {
+    std::vector<u8> data(size);
+    std::iota(data.begin(), data.end(), u8{0x5a});
+    return data;
+}
+} // Anonymous namespace
+
+TEST_CASE("Memory: Block operations across contiguous pages", "[core]") {
+    ScopeInit guard;
+    guard.Map(BASE, 16 * YUZU_PAGESIZE, TARGET);
+
+    const std::vector<u8> pattern = MakePattern(10 * YUZU_PAGESIZE);
+    const u64 addr = BASE + YUZU_PAGESIZE / 2;
+    REQUIRE(guard.memory.WriteBlock(addr, pattern.data(), pattern.size()));
+
+    const u8* const backing = guard.system.DeviceMemory().GetPointer<u8>(TARGET);
+    REQUIRE(std::memcmp(backing + YUZU_PAGESIZE / 2, pattern.data(), pattern.size()) == 0);
+
+    std::vector<u8> result(pattern.size());
+    REQUIRE(guard.memory.ReadBlock(addr, result.data(), result.size()));
+    REQUIRE(result == pattern);
+
+    REQUIRE(guard.memory.ZeroBlock(addr, YUZU_PAGESIZE * 2));
+    REQUIRE(guard.memory.ReadBlock(addr, result.data(), result.size()));
+    REQUIRE(std::all_of(result.begin(), result.begin() + YUZU_PAGESIZE * 2,
+                        [](u8 value) { return value == 0; }));
+    REQUIRE(std::equal(result.begin() + YUZU_PAGESIZE * 2, result.end(),
+                       pattern.begin() + YUZU_PAGESIZE * 2));
+}
+
+TEST_CASE("Memory: Block operations across discontiguous pages", "[core]") {
+    ScopeInit guard;
+    // Map the second half of the range before the first half in the backing memory
+    guard.Map(BASE, 4 * YUZU_PAGESIZE, TARGET + 4 * YUZU_PAGESIZE);
+    guard.Map(BASE + 4 * YUZU_PAGESIZE, 4 * YUZU_PAGESIZE, TARGET);
+
+    const std::vector<u8> pattern = MakePattern(6 * YUZU_PAGESIZE);
+    const u64 addr = BASE + YUZU_PAGESIZE;
+    REQUIRE(guard.memory.WriteBlock(addr, pattern.data(), pattern.size()));
+
+    const u8* const backing = guard.system.DeviceMemory().GetPointer<u8>(TARGET);
+    REQUIRE(std::memcmp(backing + 5 * YUZU_PAGESIZE, pattern.data(), 3 * YUZU_PAGESIZE) == 0);
+    REQUIRE(std::memcmp(backing, pattern.data() + 3 * YUZU_PAGESIZE, 3 * YUZU_PAGESIZE) == 0);
+
+    std::vector<u8> result(pattern.size());
+    REQUIRE(guard.memory.ReadBlock(addr, result.data(), result.size()));
+    REQUIRE(result == pattern);
+
+    const u64 copy_src = BASE + 2 * YUZU_PAGESIZE;
+    const u64 copy_dest = BASE + 5 * YUZU_PAGESIZE;
+    std::vector<u8> copy(3 * YUZU_PAGESIZE);
+    REQUIRE(guard.memory.CopyBlock(copy_dest, copy_src, copy.size()));
+    REQUIRE(guard.memory.ReadBlock(copy_dest, copy.data(), copy.size()));
+    REQUIRE(std::equal(copy.begin(), copy.end(), pattern.begin() + YUZU_PAGESIZE));
+}
+
+TEST_CASE("Memory: Block operation throughput", "[.][benchmark]") {
+    ScopeInit guard;
+    guard.Map(BASE, BLOCK_SIZE * 2, TARGET);
+
+    std::vector<u8> data = MakePattern(BLOCK_SIZE);
+
+    BENCHMARK("ReadBlock") {
+        return guard.memory.ReadBlock(BASE, data.data(), data.size());
+    };
+    BENCHMARK("WriteBlock") {
+        return guard.memory.WriteBlock(BASE, data.data(), data.size());
+    };
+    BENCHMARK("CopyBlock") {
+        return guard.memory.CopyBlock(BASE + BLOCK_SIZE, BASE, BLOCK_SIZE);
+    };
+    BENCHMARK("ZeroBlock") {
+        return guard.memory.ZeroBlock(BASE, BLOCK_SIZE);
+    };
+}
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+#include "common/page_table.h"
+#include "core/core.h"
+#include "core/memory.h"
+
+namespace Tests {
+
+/// Initializes a system and a guest page table that tests can map into the emulated DRAM
+struct MemoryFixture {
+    static constexpr size_t ADDRESS_SPACE_BITS = 32;
+
+    MemoryFixture() {
+        system.Initialize();
+        page_table.Resize(ADDRESS_SPACE_BITS, Core::Memory::YUZU_PAGEBITS);
+        memory.SetCurrentPageTable(page_table);
+    }
+
+    /// Maps size bytes at the guest address base to the physical address target
+    void Map(u64 base, u64 size, u64 target) {
+        memory.MapMemoryRegion(page_table, base, size, target, Common::MemoryPermission::ReadWrite,
+                               false);
+    }
+
+    Core::System system;
+    Core::Memory::Memory memory{system};
+    Common::PageTable page_table;
+};
+
+} // namespace Tests
@@ -115,6 +115,23 @@ void BufferCache<P>::WriteMemory(DAddr device_addr, u64 size) {
     memory_tracker.MarkRegionAsCpuModified(device_addr, size);
 }
 
+template <class P>
+void BufferCache<P>::UnmapMemory(DAddr device_addr, u64 size) {
+    WriteMemory(device_addr, size);
+    if constexpr (CAN_IMPORT_HOST_MEMORY) {
+        // Imported buffers alias the host pages being unmapped, they can't be used anymore
+        boost::container::small_vector<BufferId, 16> imported_ids;
+        ForEachBufferInRange(device_addr, size, [&](BufferId buffer_id, Buffer& buffer) {
+            if (buffer.IsHostMemoryImported()) {
+                imported_ids.push_back(buffer_id);
+            }
+        });
+        for (const BufferId buffer_id : imported_ids) {
+            DeleteBuffer(buffer_id);
+        }
+    }
+}
+
 template <class P>
 void BufferCache<P>::CachedWriteMemory(DAddr device_addr, u64 size) {
     const bool is_dirty = IsRegionRegistered(device_addr, size);
@@ -1371,6 +1388,17 @@ void BufferCache<P>::JoinOverlap(BufferId new_buffer_id, BufferId overlap_id,
     if (accumulate_stream_score) {
         new_buffer.IncreaseStreamScore(overlap.StreamScore() + 1);
     }
+    if constexpr (CAN_IMPORT_HOST_MEMORY) {
+        if (new_buffer.IsHostMemoryImported()) {
+            // The new buffer aliases guest memory, copying the overlap would overwrite CPU writes
+            // that haven't been uploaded yet. Write back what only the GPU has instead.
+            if (!overlap.IsHostMemoryImported()) {
+                DownloadBufferMemory(overlap);
+            }
+            DeleteBuffer(overlap_id, true);
+            return;
+        }
+    }
     boost::container::small_vector<BufferCopy, 10> copies;
     const size_t dst_base_offset = overlap.CpuAddr() - new_buffer.CpuAddr();
     copies.push_back(BufferCopy{
@@ -1393,7 +1421,13 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     const BufferId new_buffer_id = slot_buffers.insert(runtime, overlap.begin, size);
     auto& new_buffer = slot_buffers[new_buffer_id];
     const size_t size_bytes = new_buffer.SizeBytes();
-    runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
+    bool is_imported = false;
+    if constexpr (CAN_IMPORT_HOST_MEMORY) {
+        is_imported = new_buffer.IsHostMemoryImported();
+    }
+    if (!is_imported) {
+        runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
+    }
     new_buffer.MarkUsage(0, size_bytes);
     for (const BufferId overlap_id : overlap.ids) {
         JoinOverlap(new_buffer_id, overlap_id, !overlap.has_stream_leap);
@@ -1447,6 +1481,21 @@ void BufferCache<P>::TouchBuffer(Buffer& buffer, BufferId buffer_id) noexcept {
 
 template <class P>
 bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 size) {
+    if constexpr (CAN_IMPORT_HOST_MEMORY) {
+        if (buffer.IsHostMemoryImported()) {
+            const size_t offset = device_addr - buffer.CpuAddr();
+            if (device_memory.GetSpan(device_addr, size) == buffer.ImportedHostPointer() + offset) {
+                // The GPU reads guest memory directly, clearing the CPU modified ranges is enough
+                bool is_synced = true;
+                memory_tracker.ForEachUploadRange(device_addr, size,
+                                                  [&](u64, u64) { is_synced = false; });
+                return is_synced;
+            }
+            // The guest memory was remapped after the import, keep a copy of it from now on
+            buffer.DetachHostMemory();
+            memory_tracker.MarkRegionAsCpuModified(buffer.CpuAddr(), buffer.SizeBytes());
+        }
+    }
     boost::container::small_vector<BufferCopy, 4> copies;
     u64 total_size_bytes = 0;
     u64 largest_copy = 0;
@@ -1605,6 +1654,13 @@ void BufferCache<P>::DownloadBufferMemory(Buffer& buffer, DAddr device_addr, u64
     }
     MICROPROFILE_SCOPE(GPU_DownloadMemory);
 
+    if constexpr (CAN_IMPORT_HOST_MEMORY) {
+        if (buffer.IsHostMemoryImported()) {
+            // GPU writes land in guest memory, only wait for them to finish
+            runtime.Finish();
+            return;
+        }
+    }
     if constexpr (USE_MEMORY_MAPS) {
         auto download_staging = runtime.DownloadStagingBuffer(total_size_bytes);
         const u8* const mapped_memory = download_staging.mapped_span.data();
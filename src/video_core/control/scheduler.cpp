@@ -7,6 +7,7 @@
 #include "video_core/control/channel_state.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_trace.h"
 
 namespace Tegra::Control {
 Scheduler::Scheduler(GPU& gpu_) : gpu{gpu_} {}
@@ -19,6 +20,11 @@ void Scheduler::Push(s32 channel, CommandList&& entries) {
     ASSERT(it != channels.end());
     auto channel_state = it->second;
     gpu.BindChannel(channel_state->bind_id);
+    if (auto* const trace_recorder = gpu.TraceRecorder()) [[unlikely]] {
+        // Pending CPU writes have to be in the trace before the commands that may consume them
+        gpu.InvalidateGPUCache();
+        trace_recorder->RecordPush(*channel_state, entries);
+    }
     channel_state->dma_pusher->Push(std::move(entries));
     channel_state->dma_pusher->DispatchCalls();
 }
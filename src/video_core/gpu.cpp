@@ -9,6 +9,8 @@
 #include <memory>
 
 #include "common/assert.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -27,6 +29,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/gpu_thread.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/syncpoint_manager.h"
@@ -40,7 +43,11 @@ struct GPU::Impl {
     explicit Impl(GPU& gpu_, Core::System& system_, bool is_async_, bool use_nvdec_)
         : gpu{gpu_}, system{system_}, host1x{system.Host1x()}, use_nvdec{use_nvdec_},
           shader_notify{std::make_unique<VideoCore::ShaderNotify>()}, is_async{is_async_},
-          gpu_thread{system_, is_async_}, scheduler{std::make_unique<Control::Scheduler>(gpu)} {}
+          gpu_thread{system_, is_async_}, scheduler{std::make_unique<Control::Scheduler>(gpu)} {
+        if (Settings::values.gpu_trace_capture.GetValue()) {
+            CreateTraceRecorder();
+        }
+    }
 
     ~Impl() = default;
 
@@ -75,6 +82,10 @@ struct GPU::Impl {
 
     void InitAddressSpace(Tegra::MemoryManager& memory_manager) {
         memory_manager.BindRasterizer(rasterizer);
+        if (trace_recorder) [[unlikely]] {
+            trace_recorder->RecordAddressSpace(memory_manager);
+            memory_manager.BindTraceRecorder(trace_recorder.get());
+        }
     }
 
     void ReleaseChannel(Control::ChannelState& to_release) {
@@ -96,8 +107,12 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes(
-            [this](PAddr address, size_t size) { rasterizer->OnCacheInvalidation(address, size); });
+        std::function<void(PAddr, size_t)> callback_writes([this](PAddr address, size_t size) {
+            if (trace_recorder) [[unlikely]] {
+                trace_recorder->RecordMemory(address, size);
+            }
+            rasterizer->OnCacheInvalidation(address, size);
+        });
         system.GatherGPUDirtyMemory(callback_writes);
     }
 
@@ -196,6 +211,10 @@ struct GPU::Impl {
         return *shader_notify;
     }
 
+    [[nodiscard]] GpuTrace::Recorder* TraceRecorder() {
+        return trace_recorder.get();
+    }
+
     [[nodiscard]] u64 GetTicks() const {
         u64 gpu_tick = system.CoreTiming().GetGPUTicks();
 
@@ -218,6 +237,10 @@ struct GPU::Impl {
         system.GetPerfStats().EndGameFrame();
     }
 
+    void RendererPresentLatencyNotify(std::chrono::steady_clock::duration latency) {
+        system.GetPerfStats().AddPresentLatency(latency);
+    }
+
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
@@ -296,20 +319,30 @@ struct GPU::Impl {
 
     /// Notify rasterizer that any caches of the specified region should be invalidated
     void InvalidateRegion(DAddr addr, u64 size) {
+        if (trace_recorder) [[unlikely]] {
+            trace_recorder->RecordMemory(addr, size);
+        }
         gpu_thread.InvalidateRegion(addr, size);
     }
 
     bool OnCPUWrite(DAddr addr, u64 size) {
-        return rasterizer->OnCPUWrite(addr, size);
+        // While tracing, writes to mapped memory have to be gathered so they reach the trace
+        return rasterizer->OnCPUWrite(addr, size) || trace_recorder != nullptr;
     }
 
     /// Notify rasterizer that any caches of the specified region should be flushed and invalidated
     void FlushAndInvalidateRegion(DAddr addr, u64 size) {
+        if (trace_recorder) [[unlikely]] {
+            trace_recorder->RecordMemory(addr, size);
+        }
         gpu_thread.FlushAndInvalidateRegion(addr, size);
     }
 
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                           std::vector<Service::Nvidia::NvFence>&& fences) {
+        if (trace_recorder) [[unlikely]] {
+            trace_recorder->RecordComposite(layers);
+        }
         size_t num_fences{fences.size()};
         size_t current_request_counter{};
         {
@@ -358,6 +391,23 @@ struct GPU::Impl {
         return out;
     }
 
+    void CreateTraceRecorder() {
+        const auto base_dir{Common::FS::GetYuzuPath(Common::FS::YuzuPath::DumpDir)};
+        const auto trace_dir{base_dir / "gpu_traces"};
+        if (!Common::FS::CreateDir(base_dir) || !Common::FS::CreateDir(trace_dir)) {
+            LOG_ERROR(HW_GPU, "Failed to create GPU trace directory");
+            return;
+        }
+        const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch())};
+        const auto name{fmt::format("{:016X}_{}.ygt", system.GetApplicationProcessProgramID(),
+                                    seconds.count())};
+        trace_recorder = std::make_unique<GpuTrace::Recorder>(system, trace_dir / name);
+        if (!trace_recorder->IsOpen()) {
+            trace_recorder.reset();
+        }
+    }
+
     GPU& gpu;
     Core::System& system;
     Host1x::Host1x& host1x;
@@ -401,6 +451,8 @@ struct GPU::Impl {
     std::deque<size_t> free_swap_counters;
     std::deque<size_t> request_swap_counters;
     std::mutex request_swap_mutex;
+
+    std::unique_ptr<GpuTrace::Recorder> trace_recorder;
 };
 
 GPU::GPU(Core::System& system, bool is_async, bool use_nvdec)
@@ -511,6 +563,10 @@ const VideoCore::ShaderNotify& GPU::ShaderNotify() const {
     return impl->ShaderNotify();
 }
 
+GpuTrace::Recorder* GPU::TraceRecorder() {
+    return impl->TraceRecorder();
+}
+
 void GPU::RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                            std::vector<Service::Nvidia::NvFence>&& fences) {
     impl->RequestComposite(std::move(layers), std::move(fences));
@@ -536,6 +592,10 @@ void GPU::RendererFrameEndNotify() {
     impl->RendererFrameEndNotify();
 }
 
+void GPU::RendererPresentLatencyNotify(std::chrono::steady_clock::duration latency) {
+    impl->RendererPresentLatencyNotify(latency);
+}
+
 void GPU::Start() {
     impl->Start();
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "common/bit_field.h"
@@ -130,6 +131,10 @@ namespace Host1x {
 class Host1x;
 } // namespace Host1x
 
+namespace GpuTrace {
+class Recorder;
+}
+
 class MemoryManager;
 
 class GPU final {
@@ -204,6 +209,9 @@ public:
     /// Returns a const reference to the shader notifier.
     [[nodiscard]] const VideoCore::ShaderNotify& ShaderNotify() const;
 
+    /// Returns the GPU trace recorder, or nullptr when no trace is being captured.
+    [[nodiscard]] GpuTrace::Recorder* TraceRecorder();
+
     [[nodiscard]] u64 GetTicks() const;
 
     [[nodiscard]] bool IsAsync() const;
@@ -212,6 +220,9 @@ public:
 
     void RendererFrameEndNotify();
 
+    /// Reports the time a presented frame took from being queued to reaching the display
+    void RendererPresentLatencyNotify(std::chrono::steady_clock::duration latency);
+
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                           std::vector<Service::Nvidia::NvFence>&& fences);
 
@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/zstd_compression.h"
+#include "core/core.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu_trace.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/memory_manager.h"
+
+namespace Tegra::GpuTrace {
+namespace {
+
+using namespace Common::Literals;
+
+// Records are buffered and written to disk in large blocks
+constexpr size_t FLUSH_THRESHOLD = 32_MiB;
+
+// Memory is compressed in chunks, so large mappings don't need a single large allocation
+constexpr u64 MEMORY_CHUNK_SIZE = 1_MiB;
+
+// Fast Zstandard level, capturing must keep up with the game
+constexpr s32 COMPRESSION_LEVEL = 1;
+
+} // Anonymous namespace
+
+Recorder::Recorder(Core::System& system, const std::filesystem::path& path)
+    : device_memory{system.Host1x().MemoryManager()},
+      file{path, Common::FS::FileAccessMode::Write, Common::FS::FileType::BinaryFile} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to create GPU trace file {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    const FileHeader header{
+        .magic = TRACE_MAGIC,
+        .version = TRACE_VERSION,
+        .program_id = system.GetApplicationProcessProgramID(),
+    };
+    if (!file.WriteObject(header)) {
+        LOG_ERROR(HW_GPU, "Failed to write GPU trace header");
+        file.Close();
+        return;
+    }
+    buffer.reserve(FLUSH_THRESHOLD);
+    LOG_INFO(HW_GPU, "Capturing GPU trace to {}", Common::FS::PathToUTF8String(path));
+}
+
+Recorder::~Recorder() {
+    std::scoped_lock lk{mutex};
+    Flush();
+}
+
+void Recorder::RecordAddressSpace(const MemoryManager& memory_manager) {
+    std::scoped_lock lk{mutex};
+    WriteRecord(RecordType::AddressSpace, AddressSpaceRecord{
+                                              .address_space = memory_manager.GetID(),
+                                              .address_space_bits =
+                                                  memory_manager.GetAddressSpaceBits(),
+                                              .split_address = memory_manager.GetSplitAddress(),
+                                              .big_page_bits = memory_manager.GetBigPageBits(),
+                                              .page_bits = memory_manager.GetPageBits(),
+                                          });
+}
+
+void Recorder::RecordMap(const MemoryManager& memory_manager, GPUVAddr gpu_addr,
+                         DAddr device_addr, u64 size, PTEKind kind, bool is_big_pages) {
+    std::scoped_lock lk{mutex};
+    WriteRecord(RecordType::Map, MapRecord{
+                                     .address_space = memory_manager.GetID(),
+                                     .gpu_addr = gpu_addr,
+                                     .device_addr = device_addr,
+                                     .size = size,
+                                     .kind = static_cast<u32>(kind),
+                                     .flags = is_big_pages ? MapFlags::BigPages : MapFlags::None,
+                                 });
+    // Marking the pages as cached makes the CPU report its writes to them, even when no GPU cache
+    // is using them yet. Do it before reading the memory so no write is lost in between.
+    device_memory.UpdatePagesCachedCount(device_addr, size, 1);
+    RecordMemoryLocked(device_addr, size);
+}
+
+void Recorder::RecordMapSparse(const MemoryManager& memory_manager, GPUVAddr gpu_addr, u64 size,
+                               bool is_big_pages) {
+    const MapFlags flags{is_big_pages ? MapFlags::Sparse | MapFlags::BigPages : MapFlags::Sparse};
+    std::scoped_lock lk{mutex};
+    WriteRecord(RecordType::Map, MapRecord{
+                                     .address_space = memory_manager.GetID(),
+                                     .gpu_addr = gpu_addr,
+                                     .device_addr = 0,
+                                     .size = size,
+                                     .kind = static_cast<u32>(PTEKind::INVALID),
+                                     .flags = flags,
+                                 });
+}
+
+void Recorder::RecordUnmap(const MemoryManager& memory_manager, GPUVAddr gpu_addr, u64 size) {
+    std::scoped_lock lk{mutex};
+    WriteRecord(RecordType::Unmap, UnmapRecord{
+                                       .address_space = memory_manager.GetID(),
+                                       .gpu_addr = gpu_addr,
+                                       .size = size,
+                                   });
+}
+
+void Recorder::ReleaseMemory(std::span<const std::pair<DAddr, std::size_t>> ranges) {
+    for (const auto& [device_addr, size] : ranges) {
+        device_memory.UpdatePagesCachedCount(device_addr, size, -1);
+    }
+}
+
+void Recorder::RecordMemory(DAddr device_addr, u64 size) {
+    std::scoped_lock lk{mutex};
+    RecordMemoryLocked(device_addr, size);
+}
+
+void Recorder::RecordPush(const Control::ChannelState& channel, const CommandList& entries) {
+    std::scoped_lock lk{mutex};
+    const MemoryManager& memory_manager{*channel.memory_manager};
+    const u64 address_space{memory_manager.GetID()};
+    const auto [it, is_new] = channel_address_spaces.try_emplace(channel.bind_id, address_space);
+    if (is_new || it->second != address_space) {
+        it->second = address_space;
+        WriteRecord(RecordType::Channel, ChannelRecord{
+                                             .channel = channel.bind_id,
+                                             .padding = 0,
+                                             .address_space = address_space,
+                                             .program_id = channel.program_id,
+                                         });
+    }
+    for (const CommandListHeader& header : entries.command_lists) {
+        const GPUVAddr gpu_addr{header.addr};
+        const u64 size{header.size * sizeof(u32)};
+        for (const auto& [segment_addr, segment_size] :
+             memory_manager.GetSubmappedRange(gpu_addr, size)) {
+            if (const auto device_addr = memory_manager.GpuToCpuAddress(segment_addr)) {
+                RecordMemoryLocked(*device_addr, segment_size);
+            }
+        }
+    }
+    const size_t command_lists_size{entries.command_lists.size() * sizeof(CommandListHeader)};
+    const size_t prefetch_size{entries.prefetch_command_list.size() * sizeof(CommandHeader)};
+    std::vector<u8> data(command_lists_size + prefetch_size);
+    std::memcpy(data.data(), entries.command_lists.data(), command_lists_size);
+    std::memcpy(data.data() + command_lists_size, entries.prefetch_command_list.data(),
+                prefetch_size);
+    WriteRecord(RecordType::Push,
+                PushRecord{
+                    .channel = channel.bind_id,
+                    .num_command_lists = static_cast<u32>(entries.command_lists.size()),
+                    .num_prefetch_words = static_cast<u32>(entries.prefetch_command_list.size()),
+                    .padding = 0,
+                },
+                data);
+}
+
+void Recorder::RecordComposite(std::span<const FramebufferConfig> layers) {
+    std::scoped_lock lk{mutex};
+    WriteRecord(RecordType::Composite,
+                CompositeRecord{
+                    .num_layers = static_cast<u32>(layers.size()),
+                    .padding = 0,
+                },
+                std::span<const u8>(reinterpret_cast<const u8*>(layers.data()),
+                                    layers.size_bytes()));
+}
+
+void Recorder::RecordMemoryLocked(DAddr device_addr, u64 size) {
+    while (size > 0) {
+        const u64 chunk_size{std::min(size, MEMORY_CHUNK_SIZE)};
+        memory_buffer.resize(chunk_size);
+        device_memory.ReadBlockUnsafe(device_addr, memory_buffer.data(), chunk_size);
+
+        MemoryRecord record{
+            .device_addr = device_addr,
+            .size = chunk_size,
+            .compressed_size = 0,
+        };
+        if (std::ranges::all_of(memory_buffer, [](u8 value) { return value == 0; })) {
+            // Cleared memory is common in fresh mappings, it doesn't need to be stored
+            WriteRecord(RecordType::Memory, record);
+        } else {
+            const std::vector<u8> compressed{Common::Compression::CompressDataZSTD(
+                memory_buffer.data(), memory_buffer.size(), COMPRESSION_LEVEL)};
+            record.compressed_size = compressed.size();
+            WriteRecord(RecordType::Memory, record, compressed);
+        }
+        device_addr += chunk_size;
+        size -= chunk_size;
+    }
+}
+
+template <typename T>
+void Recorder::WriteRecord(RecordType type, const T& record, std::span<const u8> data) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    const RecordHeader header{
+        .type = type,
+        .size = static_cast<u32>(sizeof(T) + data.size()),
+    };
+    const auto append{[this](const void* source, size_t size) {
+        const u8* const bytes{static_cast<const u8*>(source)};
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }};
+    append(&header, sizeof(header));
+    append(&record, sizeof(record));
+    append(data.data(), data.size());
+    if (buffer.size() >= FLUSH_THRESHOLD) {
+        Flush();
+    }
+}
+
+void Recorder::Flush() {
+    if (buffer.empty()) {
+        return;
+    }
+    if (file.WriteSpan(std::span<const u8>(buffer)) != buffer.size()) {
+        LOG_ERROR(HW_GPU, "Failed to write GPU trace, the trace is incomplete");
+    }
+    buffer.clear();
+}
+
+Reader::Reader(const std::filesystem::path& path)
+    : file{path, Common::FS::FileAccessMode::Read, Common::FS::FileType::BinaryFile} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU trace {}", Common::FS::PathToUTF8String(path));
+        return;
+    }
+    if (!file.ReadObject(header) || header.magic != TRACE_MAGIC) {
+        LOG_ERROR(HW_GPU, "{} is not a GPU trace", Common::FS::PathToUTF8String(path));
+        return;
+    }
+    if (header.version != TRACE_VERSION) {
+        LOG_ERROR(HW_GPU, "Unsupported GPU trace version {}", header.version);
+        return;
+    }
+    is_valid = true;
+}
+
+Reader::~Reader() = default;
+
+bool Reader::Next(RecordType& type, std::vector<u8>& data) {
+    RecordHeader record_header;
+    if (!is_valid || !file.ReadObject(record_header)) {
+        return false;
+    }
+    data.resize(record_header.size);
+    if (file.ReadSpan(std::span<u8>(data)) != data.size()) {
+        LOG_ERROR(HW_GPU, "GPU trace is truncated");
+        return false;
+    }
+    type = record_header.type;
+    return true;
+}
+
+void Reader::Rewind() {
+    if (!file.Seek(sizeof(FileHeader))) {
+        LOG_ERROR(HW_GPU, "Failed to rewind GPU trace");
+        is_valid = false;
+    }
+}
+
+} // namespace Tegra::GpuTrace
@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/framebuffer_config.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/pte_kind.h"
+
+namespace Core {
+class System;
+}
+
+namespace Tegra {
+struct CommandList;
+class MemoryManager;
+
+namespace Control {
+struct ChannelState;
+}
+
+/**
+ * GPU command traces record what the GPU observes from the guest, so video_core can be replayed
+ * and benchmarked without running the application. A trace holds, in the order the GPU saw them:
+ *
+ * - GPU address spaces, their mappings and unmappings
+ * - Device memory contents when they get mapped, and every later CPU write to mapped memory
+ * - GPFIFO entries submitted to each channel, preceded by the pushbuffer words they point to
+ * - Presented frames
+ *
+ * The file starts with a FileHeader and is followed by records. Each record is a RecordHeader
+ * followed by the record structure of its type and the data that structure describes.
+ */
+namespace GpuTrace {
+
+constexpr u32 TRACE_MAGIC = 0x54504759; // "YGPT"
+constexpr u32 TRACE_VERSION = 1;
+
+enum class RecordType : u32 {
+    AddressSpace = 0,
+    Map = 1,
+    Unmap = 2,
+    Memory = 3,
+    Channel = 4,
+    Push = 5,
+    Composite = 6,
+};
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+    u64 program_id;
+};
+static_assert(sizeof(FileHeader) == 16);
+
+struct RecordHeader {
+    RecordType type;
+    u32 size; ///< Size in bytes of the record, including its trailing data
+};
+static_assert(sizeof(RecordHeader) == 8);
+
+struct AddressSpaceRecord {
+    u64 address_space;
+    u64 address_space_bits;
+    GPUVAddr split_address;
+    u64 big_page_bits;
+    u64 page_bits;
+};
+
+enum class MapFlags : u32 {
+    None = 0,
+    BigPages = 1 << 0,
+    Sparse = 1 << 1,
+};
+DECLARE_ENUM_FLAG_OPERATORS(MapFlags)
+
+struct MapRecord {
+    u64 address_space;
+    GPUVAddr gpu_addr;
+    DAddr device_addr;
+    u64 size;
+    u32 kind;
+    MapFlags flags;
+};
+
+struct UnmapRecord {
+    u64 address_space;
+    GPUVAddr gpu_addr;
+    u64 size;
+};
+
+/// Followed by compressed_size bytes of Zstandard data, memory is cleared when there is none
+struct MemoryRecord {
+    DAddr device_addr;
+    u64 size;
+    u64 compressed_size;
+};
+
+struct ChannelRecord {
+    s32 channel;
+    u32 padding;
+    u64 address_space;
+    u64 program_id;
+};
+
+/// Followed by the raw command list headers and the prefetched command words
+struct PushRecord {
+    s32 channel;
+    u32 num_command_lists;
+    u32 num_prefetch_words;
+    u32 padding;
+};
+
+/// Followed by the framebuffer configuration of each layer
+struct CompositeRecord {
+    u32 num_layers;
+    u32 padding;
+};
+static_assert(std::is_trivially_copyable_v<FramebufferConfig>);
+
+/// Writes a trace of the GPU activity of the running application
+class Recorder {
+public:
+    explicit Recorder(Core::System& system, const std::filesystem::path& path);
+    ~Recorder();
+
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    void RecordAddressSpace(const MemoryManager& memory_manager);
+
+    /// Records a mapping and the memory it maps. The mapped memory is kept tracked so CPU writes
+    /// to it reach the trace.
+    void RecordMap(const MemoryManager& memory_manager, GPUVAddr gpu_addr, DAddr device_addr,
+                   u64 size, PTEKind kind, bool is_big_pages);
+
+    void RecordMapSparse(const MemoryManager& memory_manager, GPUVAddr gpu_addr, u64 size,
+                         bool is_big_pages);
+
+    void RecordUnmap(const MemoryManager& memory_manager, GPUVAddr gpu_addr, u64 size);
+
+    /// Stops tracking device memory that is no longer mapped by an address space
+    void ReleaseMemory(std::span<const std::pair<DAddr, std::size_t>> ranges);
+
+    /// Records the current contents of device memory
+    void RecordMemory(DAddr device_addr, u64 size);
+
+    /// Records command lists submitted to a channel, along with the pushbuffers they reference
+    void RecordPush(const Control::ChannelState& channel, const CommandList& entries);
+
+    void RecordComposite(std::span<const FramebufferConfig> layers);
+
+private:
+    void RecordMemoryLocked(DAddr device_addr, u64 size);
+
+    template <typename T>
+    void WriteRecord(RecordType type, const T& record, std::span<const u8> data = {});
+
+    void Flush();
+
+    MaxwellDeviceMemoryManager& device_memory;
+
+    std::mutex mutex;
+    Common::FS::IOFile file;
+    std::vector<u8> buffer;
+    std::vector<u8> memory_buffer;
+    std::unordered_map<s32, u64> channel_address_spaces;
+};
+
+/// Reads the records of a trace sequentially
+class Reader {
+public:
+    explicit Reader(const std::filesystem::path& path);
+    ~Reader();
+
+    [[nodiscard]] bool IsOpen() const {
+        return is_valid;
+    }
+
+    [[nodiscard]] u64 ProgramId() const {
+        return header.program_id;
+    }
+
+    /// Reads the next record into data, returns false at the end of the trace
+    [[nodiscard]] bool Next(RecordType& type, std::vector<u8>& data);
+
+    /// Restarts reading from the first record
+    void Rewind();
+
+private:
+    Common::FS::IOFile file;
+    FileHeader header{};
+    bool is_valid{};
+};
+
+} // namespace GpuTrace
+
+} // namespace Tegra
@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/alignment.h"
+#include "common/logging/log.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+#include "common/zstd_compression.h"
+#include "core/core.h"
+#include "core/hle/kernel/k_memory_manager.h"
+#include "core/hle/kernel/k_page_group.h"
+#include "core/hle/kernel/k_system_resource.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/memory.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu.h"
+#include "video_core/gpu_trace_player.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/memory_manager.h"
+
+namespace Tegra::GpuTrace {
+namespace {
+
+template <typename T>
+bool ReadRecord(std::span<const u8> data, T& record) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (data.size() < sizeof(T)) {
+        LOG_ERROR(HW_GPU, "GPU trace record is too small");
+        return false;
+    }
+    std::memcpy(&record, data.data(), sizeof(T));
+    return true;
+}
+
+} // Anonymous namespace
+
+Player::Player(Core::System& system_, const std::filesystem::path& path)
+    : system{system_}, reader{path} {
+    if (!reader.IsOpen()) {
+        return;
+    }
+    is_open = AllocateMemory();
+    reader.Rewind();
+}
+
+Player::~Player() {
+    auto& device_memory{system.Host1x().MemoryManager()};
+    for (const auto& [device_addr, size] : device_ranges) {
+        device_memory.Unmap(device_addr, size);
+        device_memory.Free(device_addr, size);
+    }
+    if (backing) {
+        backing->Close();
+    }
+}
+
+bool Player::AllocateMemory() {
+    // Gather all the device memory the trace touches, it's backed before anything is replayed
+    Common::RangeSet<DAddr> ranges;
+    RecordType type;
+    std::vector<u8> data;
+    while (reader.Next(type, data)) {
+        if (type == RecordType::Map) {
+            MapRecord record;
+            if (ReadRecord(data, record) && !True(record.flags & MapFlags::Sparse)) {
+                ranges.Add(record.device_addr, record.size);
+            }
+        } else if (type == RecordType::Memory) {
+            MemoryRecord record;
+            if (ReadRecord(data, record)) {
+                ranges.Add(record.device_addr, record.size);
+            }
+        }
+    }
+    size_t num_pages{};
+    ranges.ForEach([&](DAddr begin, DAddr end) {
+        const DAddr aligned_begin{Common::AlignDown(begin, Core::Memory::YUZU_PAGESIZE)};
+        const DAddr aligned_end{Common::AlignUp(end, Core::Memory::YUZU_PAGESIZE)};
+        if (!device_ranges.empty()) {
+            // Ranges may overlap once aligned to pages
+            auto& [last_addr, last_size] = device_ranges.back();
+            if (last_addr + last_size >= aligned_begin) {
+                last_size = aligned_end - last_addr;
+                return;
+            }
+        }
+        device_ranges.emplace_back(aligned_begin, aligned_end - aligned_begin);
+    });
+    for (const auto& [device_addr, size] : device_ranges) {
+        num_pages += size / Core::Memory::YUZU_PAGESIZE;
+    }
+    if (num_pages == 0) {
+        return true;
+    }
+
+    auto& kernel{system.Kernel()};
+    backing = std::make_unique<Kernel::KPageGroup>(
+        kernel, kernel.GetSystemSystemResource().GetBlockInfoManagerPointer());
+    const Result result{kernel.MemoryManager().AllocateAndOpen(
+        backing.get(), num_pages,
+        Kernel::KMemoryManager::EncodeOption(Kernel::KMemoryManager::Pool::Application,
+                                             Kernel::KMemoryManager::Direction::FromFront))};
+    if (result.IsError()) {
+        LOG_ERROR(HW_GPU, "Failed to allocate {} MiB of memory for the GPU trace",
+                  (num_pages * Core::Memory::YUZU_PAGESIZE) >> 20);
+        backing.reset();
+        device_ranges.clear();
+        return false;
+    }
+
+    // Hand out the allocated blocks to the device ranges in order
+    auto& device_memory{system.Host1x().MemoryManager()};
+    auto block{backing->begin()};
+    size_t block_offset{};
+    for (const auto& [device_addr, size] : device_ranges) {
+        device_memory.AllocateFixed(device_addr, size);
+        size_t offset{};
+        while (offset < size) {
+            const size_t copy_size{std::min(size - offset, block->GetSize() - block_offset)};
+            device_memory.MapPhysical(device_addr + offset,
+                                      GetInteger(block->GetAddress()) + block_offset, copy_size);
+            offset += copy_size;
+            block_offset += copy_size;
+            if (block_offset == block->GetSize()) {
+                ++block;
+                block_offset = 0;
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<std::chrono::nanoseconds> Player::Run() {
+    frame_times.clear();
+    frame_start = std::chrono::steady_clock::now();
+    RecordType type;
+    std::vector<u8> data;
+    while (reader.Next(type, data)) {
+        ReplayRecord(type, data);
+    }
+    return std::move(frame_times);
+}
+
+void Player::ReplayRecord(RecordType type, std::span<const u8> data) {
+    auto& gpu{system.GPU()};
+    switch (type) {
+    case RecordType::AddressSpace: {
+        AddressSpaceRecord record;
+        if (!ReadRecord(data, record)) {
+            return;
+        }
+        auto memory_manager{std::make_shared<MemoryManager>(
+            system, record.address_space_bits, record.split_address, record.big_page_bits,
+            record.page_bits)};
+        gpu.InitAddressSpace(*memory_manager);
+        address_spaces.insert_or_assign(record.address_space, std::move(memory_manager));
+        return;
+    }
+    case RecordType::Map: {
+        MapRecord record;
+        if (!ReadRecord(data, record)) {
+            return;
+        }
+        const auto it{address_spaces.find(record.address_space)};
+        if (it == address_spaces.end()) {
+            LOG_ERROR(HW_GPU, "Mapping to unknown address space {}", record.address_space);
+            return;
+        }
+        const bool is_big_pages{True(record.flags & MapFlags::BigPages)};
+        if (True(record.flags & MapFlags::Sparse)) {
+            it->second->MapSparse(record.gpu_addr, record.size, is_big_pages);
+        } else {
+            it->second->Map(record.gpu_addr, record.device_addr, record.size,
+                            static_cast<PTEKind>(record.kind), is_big_pages);
+        }
+        return;
+    }
+    case RecordType::Unmap: {
+        UnmapRecord record;
+        if (!ReadRecord(data, record)) {
+            return;
+        }
+        const auto it{address_spaces.find(record.address_space)};
+        if (it == address_spaces.end()) {
+            LOG_ERROR(HW_GPU, "Unmapping from unknown address space {}", record.address_space);
+            return;
+        }
+        it->second->Unmap(record.gpu_addr, record.size);
+        return;
+    }
+    case RecordType::Memory: {
+        MemoryRecord record;
+        if (!ReadRecord(data, record) || data.size() - sizeof(record) < record.compressed_size) {
+            return;
+        }
+        if (record.compressed_size == 0) {
+            memory_buffer.assign(record.size, 0);
+        } else {
+            memory_buffer = Common::Compression::DecompressDataZSTD(
+                data.subspan(sizeof(record), record.compressed_size));
+            if (memory_buffer.size() != record.size) {
+                LOG_ERROR(HW_GPU, "Corrupted memory record at 0x{:X}", record.device_addr);
+                return;
+            }
+        }
+        auto& device_memory{system.Host1x().MemoryManager()};
+        device_memory.WriteBlockUnsafe(record.device_addr, memory_buffer.data(), record.size);
+        gpu.InvalidateRegion(record.device_addr, record.size);
+        return;
+    }
+    case RecordType::Channel: {
+        ChannelRecord record;
+        if (!ReadRecord(data, record)) {
+            return;
+        }
+        const auto it{address_spaces.find(record.address_space)};
+        if (it == address_spaces.end()) {
+            LOG_ERROR(HW_GPU, "Channel bound to unknown address space {}", record.address_space);
+            return;
+        }
+        if (channels.contains(record.channel)) {
+            LOG_WARNING(HW_GPU, "Rebinding the address space of channel {} is not supported",
+                        record.channel);
+            return;
+        }
+        auto channel{gpu.AllocateChannel()};
+        channel->memory_manager = it->second;
+        gpu.InitChannel(*channel, record.program_id);
+        channels.emplace(record.channel, std::move(channel));
+        return;
+    }
+    case RecordType::Push: {
+        PushRecord record;
+        if (!ReadRecord(data, record)) {
+            return;
+        }
+        const size_t command_lists_size{record.num_command_lists * sizeof(CommandListHeader)};
+        const size_t prefetch_size{record.num_prefetch_words * sizeof(CommandHeader)};
+        if (data.size() - sizeof(record) < command_lists_size + prefetch_size) {
+            LOG_ERROR(HW_GPU, "GPU trace push record is too small");
+            return;
+        }
+        const auto it{channels.find(record.channel)};
+        if (it == channels.end()) {
+            LOG_ERROR(HW_GPU, "Push to unknown channel {}", record.channel);
+            return;
+        }
+        CommandList entries(record.num_command_lists);
+        entries.prefetch_command_list.resize(record.num_prefetch_words);
+        const u8* const source{data.data() + sizeof(record)};
+        std::memcpy(entries.command_lists.data(), source, command_lists_size);
+        std::memcpy(entries.prefetch_command_list.data(), source + command_lists_size,
+                    prefetch_size);
+        gpu.PushGPUEntries(it->second->bind_id, std::move(entries));
+        return;
+    }
+    case RecordType::Composite: {
+        CompositeRecord record;
+        if (!ReadRecord(data, record) ||
+            data.size() - sizeof(record) < record.num_layers * sizeof(FramebufferConfig)) {
+            return;
+        }
+        std::vector<FramebufferConfig> layers(record.num_layers);
+        std::memcpy(layers.data(), data.data() + sizeof(record),
+                    record.num_layers * sizeof(FramebufferConfig));
+        // Fences of the original submission are already satisfied by the replay order
+        gpu.RequestComposite(std::move(layers), {});
+
+        const auto now{std::chrono::steady_clock::now()};
+        frame_times.push_back(now - frame_start);
+        frame_start = now;
+        return;
+    }
+    }
+    LOG_ERROR(HW_GPU, "Unknown GPU trace record type {}", static_cast<u32>(type));
+}
+
+} // namespace Tegra::GpuTrace
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/gpu_trace.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class KPageGroup;
+}
+
+namespace Tegra {
+class MemoryManager;
+
+namespace Control {
+struct ChannelState;
+}
+
+namespace GpuTrace {
+
+/**
+ * Replays a GPU trace on the GPU of a system set up with System::SetupForGpuReplay.
+ * Device memory used by the trace is backed with physical memory allocated from the kernel, so
+ * no application process is needed.
+ */
+class Player {
+public:
+    explicit Player(Core::System& system, const std::filesystem::path& path);
+    ~Player();
+
+    Player(const Player&) = delete;
+    Player& operator=(const Player&) = delete;
+
+    [[nodiscard]] bool IsOpen() const {
+        return is_open;
+    }
+
+    /// Replays the whole trace, returns the time spent on each presented frame
+    std::vector<std::chrono::nanoseconds> Run();
+
+private:
+    bool AllocateMemory();
+
+    void ReplayRecord(RecordType type, std::span<const u8> data);
+
+    Core::System& system;
+    Reader reader;
+    bool is_open{};
+
+    std::unique_ptr<Kernel::KPageGroup> backing;
+    std::vector<std::pair<DAddr, size_t>> device_ranges;
+
+    std::unordered_map<u64, std::shared_ptr<MemoryManager>> address_spaces;
+    std::unordered_map<s32, std::shared_ptr<Control::ChannelState>> channels;
+
+    std::vector<u8> memory_buffer;
+    std::chrono::steady_clock::time_point frame_start;
+    std::vector<std::chrono::nanoseconds> frame_times;
+};
+
+} // namespace GpuTrace
+
+} // namespace Tegra
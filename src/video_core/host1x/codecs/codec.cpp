@@ -11,11 +11,18 @@
 #include "video_core/memory_manager.h"
 
 namespace Tegra {
+namespace {
+/// Bitstreams that may be queued for decoding before the submitting thread waits
+constexpr size_t MAX_DECODES_IN_FLIGHT = 2;
+
+/// Decoded frames kept for VIC before the oldest are dropped
+constexpr size_t MAX_PENDING_FRAMES = 10;
+} // Anonymous namespace
 
 Codec::Codec(Host1x::Host1x& host1x_, const Host1x::NvdecCommon::NvdecRegisters& regs)
     : host1x(host1x_), state{regs}, h264_decoder(std::make_unique<Decoder::H264>(host1x)),
       vp8_decoder(std::make_unique<Decoder::VP8>(host1x)),
-      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)) {}
+      vp9_decoder(std::make_unique<Decoder::VP9>(host1x)), decode_thread(1, "NvdecDecoder") {}
 
 Codec::~Codec() = default;
 
@@ -59,26 +66,49 @@ void Codec::Decode() {
         }
     }();
 
-    // Send assembled bitstream to decoder.
-    if (!decode_api.SendPacket(packet_data, configuration_size)) {
-        return;
+    // The bitstream is built in the decoders' buffers, copy it for the decode thread.
+    // Bitstreams are composed here since they read the registers and guest memory in order.
+    std::vector<u8> packet(packet_data.begin(), packet_data.end());
+    {
+        std::unique_lock lock{frames_mutex};
+        frames_cv.wait(lock, [this] { return decodes_in_flight < MAX_DECODES_IN_FLIGHT; });
+        ++decodes_in_flight;
     }
+    decode_thread.QueueWork(
+        [this, packet = std::move(packet), configuration_size, vp9_hidden_frame] {
+            DecodePacket(packet, configuration_size, vp9_hidden_frame);
+        });
+}
+
+void Codec::DecodePacket(std::span<const u8> packet_data, size_t configuration_size,
+                         bool vp9_hidden_frame) {
+    std::queue<std::unique_ptr<FFmpeg::Frame>> decoded_frames;
 
+    // Send assembled bitstream to decoder.
     // Only receive/store visible frames.
-    if (vp9_hidden_frame) {
-        return;
+    if (decode_api.SendPacket(packet_data, configuration_size) && !vp9_hidden_frame) {
+        // Receive output frames from decoder.
+        decode_api.ReceiveFrames(decoded_frames);
     }
-
-    // Receive output frames from decoder.
-    decode_api.ReceiveFrames(frames);
-
-    while (frames.size() > 10) {
-        LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
-        frames.pop();
+    {
+        std::scoped_lock lock{frames_mutex};
+        while (!decoded_frames.empty()) {
+            frames.push(std::move(decoded_frames.front()));
+            decoded_frames.pop();
+        }
+        while (frames.size() > MAX_PENDING_FRAMES) {
+            LOG_DEBUG(HW_GPU, "ReceiveFrames overflow, dropped frame");
+            frames.pop();
+        }
+        --decodes_in_flight;
     }
+    frames_cv.notify_all();
 }
 
 std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
+    std::unique_lock lock{frames_mutex};
+    frames_cv.wait(lock, [this] { return !frames.empty() || decodes_in_flight == 0; });
+
     // Sometimes VIC will request more frames than have been decoded.
     // in this case, return a blank frame and don't overwrite previous data.
     if (frames.empty()) {
@@ -90,6 +120,22 @@ std::unique_ptr<FFmpeg::Frame> Codec::GetCurrentFrame() {
     return frame;
 }
 
+void Codec::SignalWhenDone(std::function<void()>&& func) {
+    {
+        std::scoped_lock lock{frames_mutex};
+        if (decodes_in_flight != 0) {
+            // The decode thread runs its work in order, this runs after the queued decodes
+            decode_thread.QueueWork(std::move(func));
+            return;
+        }
+    }
+    func();
+}
+
+void Codec::WaitIdle() {
+    decode_thread.WaitForRequests();
+}
+
 Host1x::NvdecCommon::VideoCodec Codec::GetCurrentCodec() const {
     return current_codec;
 }
@@ -3,11 +3,16 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string_view>
 #include <queue>
+#include <vector>
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 #include "video_core/host1x/nvdec_common.h"
 
@@ -34,12 +39,18 @@ public:
     /// Sets NVDEC video stream codec
     void SetTargetCodec(Host1x::NvdecCommon::VideoCodec codec);
 
-    /// Call decoders to construct headers, decode AVFrame with ffmpeg
+    /// Call decoders to construct headers, queue the bitstream to be decoded with ffmpeg
     void Decode();
 
-    /// Returns next decoded frame
+    /// Returns next decoded frame, waiting for the decodes in flight when none is ready
     [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetCurrentFrame();
 
+    /// Calls func once all the decodes queued so far have completed
+    void SignalWhenDone(std::function<void()>&& func);
+
+    /// Waits for all the decodes queued so far
+    void WaitIdle();
+
     /// Returns the value of current_codec
     [[nodiscard]] Host1x::NvdecCommon::VideoCodec GetCurrentCodec() const;
 
@@ -47,6 +58,10 @@ public:
     [[nodiscard]] std::string_view GetCurrentCodecName() const;
 
 private:
+    /// Decodes a bitstream on the decode thread
+    void DecodePacket(std::span<const u8> packet_data, size_t configuration_size,
+                      bool vp9_hidden_frame);
+
     bool initialized{};
     Host1x::NvdecCommon::VideoCodec current_codec{Host1x::NvdecCommon::VideoCodec::None};
     FFmpeg::DecodeApi decode_api;
@@ -57,7 +72,13 @@ private:
     std::unique_ptr<Decoder::VP8> vp8_decoder;
     std::unique_ptr<Decoder::VP9> vp9_decoder;
 
+    std::mutex frames_mutex;
+    std::condition_variable frames_cv;
     std::queue<std::unique_ptr<FFmpeg::Frame>> frames{};
+    size_t decodes_in_flight{};
+
+    /// Destroyed first, so queued decodes never outlive the decoder
+    Common::ThreadWorker decode_thread;
 };
 
 } // namespace Tegra
@@ -8,6 +8,8 @@
 #include "video_core/host1x/ffmpeg/ffmpeg.h"
 
 extern "C" {
+#include <libavutil/imgutils.h>
+
 #ifdef LIBVA_FOUND
 // for querying VAAPI driver information
 #include <libavutil/hwcontext_vaapi.h>
@@ -20,6 +22,7 @@ namespace {
 
 constexpr AVPixelFormat PreferredGpuFormat = AV_PIX_FMT_NV12;
 constexpr AVPixelFormat PreferredCpuFormat = AV_PIX_FMT_YUV420P;
+constexpr int TransferFrameAlignment = 32;
 constexpr std::array PreferredGpuDecoders = {
     AV_HWDEVICE_TYPE_CUDA,
 #ifdef _WIN32
@@ -193,6 +196,9 @@ DecoderContext::DecoderContext(const Decoder& decoder) {
 DecoderContext::~DecoderContext() {
     av_buffer_unref(&m_codec_context->hw_device_ctx);
     avcodec_free_context(&m_codec_context);
+
+    // Buffers still held by pending frames keep the pool alive until they are released.
+    av_buffer_pool_uninit(&m_transfer_pool);
 }
 
 void DecoderContext::InitializeHardwareDecoder(const HardwareContext& context,
@@ -251,7 +257,9 @@ std::unique_ptr<Frame> DecoderContext::ReceiveFrame(bool* out_is_interlaced) {
             return {};
         }
 
-        dst_frame->SetFormat(PreferredGpuFormat);
+        if (!AllocateTransferFrame(*dst_frame, intermediate_frame)) {
+            return {};
+        }
         if (const int ret =
                 av_hwframe_transfer_data(dst_frame->GetFrame(), intermediate_frame.GetFrame(), 0);
             ret < 0) {
@@ -268,6 +276,45 @@ std::unique_ptr<Frame> DecoderContext::ReceiveFrame(bool* out_is_interlaced) {
     return dst_frame;
 }
 
+bool DecoderContext::AllocateTransferFrame(Frame& dst_frame, const Frame& src_frame) {
+    // av_hwframe_transfer_data allocates a new buffer for every frame it is given without one,
+    // hand it buffers from a pool instead.
+    AVFrame* const frame = dst_frame.GetFrame();
+    frame->format = PreferredGpuFormat;
+    frame->width = src_frame.GetWidth();
+    frame->height = src_frame.GetHeight();
+
+    const int size = av_image_get_buffer_size(PreferredGpuFormat, frame->width, frame->height,
+                                              TransferFrameAlignment);
+    if (size < 0) {
+        LOG_ERROR(HW_GPU, "av_image_get_buffer_size error: {}", AVError(size));
+        return false;
+    }
+
+    if (!m_transfer_pool || m_transfer_pool_size != size) {
+        av_buffer_pool_uninit(&m_transfer_pool);
+        m_transfer_pool = av_buffer_pool_init(static_cast<size_t>(size), nullptr);
+        m_transfer_pool_size = size;
+    }
+
+    frame->buf[0] = av_buffer_pool_get(m_transfer_pool);
+    if (!frame->buf[0]) {
+        LOG_ERROR(HW_GPU, "av_buffer_pool_get failed");
+        return false;
+    }
+
+    if (const int ret =
+            av_image_fill_arrays(frame->data, frame->linesize, frame->buf[0]->data,
+                                 PreferredGpuFormat, frame->width, frame->height,
+                                 TransferFrameAlignment);
+        ret < 0) {
+        LOG_ERROR(HW_GPU, "av_image_fill_arrays error: {}", AVError(ret));
+        return false;
+    }
+
+    return true;
+}
+
 DeinterlaceFilter::DeinterlaceFilter(const Frame& frame) {
     const AVFilter* buffer_src = avfilter_get_by_name("buffer");
     const AVFilter* buffer_sink = avfilter_get_by_name("buffersink");
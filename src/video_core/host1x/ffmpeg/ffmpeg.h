@@ -167,7 +167,13 @@ public:
     }
 
 private:
+    bool AllocateTransferFrame(Frame& dst_frame, const Frame& src_frame);
+
     AVCodecContext* m_codec_context{};
+
+    // Pool of the buffers hardware frames are transferred to, reused across frames.
+    AVBufferPool* m_transfer_pool{};
+    int m_transfer_pool_size{};
 };
 
 // Wraps an AVFilterGraph.
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include "common/common_types.h"
@@ -25,6 +26,12 @@ public:
     /// Return most recently decoded frame
     [[nodiscard]] std::unique_ptr<FFmpeg::Frame> GetFrame();
 
+    /// Calls func once the frames submitted so far have been decoded
+    void SignalWhenDone(std::function<void()>&& func);
+
+    /// Waits for the frames submitted so far to be decoded
+    void WaitIdle();
+
 private:
     /// Invoke codec to decode a frame
     void Execute();
@@ -1,7 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
 
 extern "C" {
 #if defined(__GNUC__) || defined(__clang__)
@@ -19,6 +27,7 @@ extern "C" {
 #include "common/logging/log.h"
 
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/nvdec.h"
 #include "video_core/host1x/vic.h"
@@ -36,6 +45,28 @@ enum class VideoPixelFormat : u64_le {
     RGBX8 = 0x23,
     YUV420 = 0x44,
 };
+
+/// Interleaves two chroma planes into the UV plane of an NV12 surface
+void InterleaveChroma(u8* dst, const u8* chroma_b, const u8* chroma_r, size_t count) {
+    size_t x = 0;
+#if defined(ARCHITECTURE_x86_64)
+    for (; x + 16 <= count; x += 16) {
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chroma_b + x));
+        const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chroma_r + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2), _mm_unpacklo_epi8(b, r));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 2 + 16), _mm_unpackhi_epi8(b, r));
+    }
+#elif defined(ARCHITECTURE_arm64)
+    for (; x + 16 <= count; x += 16) {
+        const uint8x16x2_t br{vld1q_u8(chroma_b + x), vld1q_u8(chroma_r + x)};
+        vst2q_u8(dst + x * 2, br);
+    }
+#endif
+    for (; x < count; ++x) {
+        dst[x * 2] = chroma_b[x];
+        dst[x * 2 + 1] = chroma_r[x];
+    }
+}
 } // Anonymous namespace
 
 union VicConfig {
@@ -114,38 +145,26 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
 
     const auto frame_width = frame->GetWidth();
     const auto frame_height = frame->GetHeight();
-    const auto frame_format = frame->GetPixelFormat();
-
-    if (!scaler_ctx || frame_width != scaler_width || frame_height != scaler_height) {
-        const AVPixelFormat target_format = [pixel_format = config.pixel_format]() {
-            switch (pixel_format) {
-            case VideoPixelFormat::RGBA8:
-                return AV_PIX_FMT_RGBA;
-            case VideoPixelFormat::BGRA8:
-                return AV_PIX_FMT_BGRA;
-            case VideoPixelFormat::RGBX8:
-                return AV_PIX_FMT_RGB0;
-            default:
-                return AV_PIX_FMT_RGBA;
-            }
-        }();
-
-        sws_freeContext(scaler_ctx);
-        // Frames are decoded into either YUV420 or NV12 formats. Convert to desired RGB format
-        scaler_ctx = sws_getContext(frame_width, frame_height, frame_format, frame_width,
-                                    frame_height, target_format, 0, nullptr, nullptr, nullptr);
-        scaler_width = frame_width;
-        scaler_height = frame_height;
-        converted_frame_buffer.reset();
-    }
-    if (!converted_frame_buffer) {
-        const size_t frame_size = frame_width * frame_height * 4;
-        converted_frame_buffer = AVMallocPtr{static_cast<u8*>(av_malloc(frame_size)), av_free};
+    const AVPixelFormat target_format = [pixel_format = config.pixel_format]() {
+        switch (pixel_format) {
+        case VideoPixelFormat::RGBA8:
+            return AV_PIX_FMT_RGBA;
+        case VideoPixelFormat::BGRA8:
+            return AV_PIX_FMT_BGRA;
+        case VideoPixelFormat::RGBX8:
+            return AV_PIX_FMT_RGB0;
+        default:
+            return AV_PIX_FMT_RGBA;
+        }
+    }();
+    // Frames are decoded into either YUV420 or NV12 formats. Convert to desired RGB format
+    SwsContext* const scaler = GetScaler(frame_width, frame_height, frame->GetPixelFormat(),
+                                         target_format);
+    if (!scaler) {
+        LOG_ERROR(Service_NVDRV, "Failed to create a scaler for {}x{} frames", frame_width,
+                  frame_height);
+        return;
     }
-    const std::array<int, 4> converted_stride{frame_width * 4, frame_height * 4, 0, 0};
-    u8* const converted_frame_buf_addr{converted_frame_buffer.get()};
-    sws_scale(scaler_ctx, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
-              &converted_frame_buf_addr, converted_stride.data());
 
     // Use the minimum of surface/frame dimensions to avoid buffer overflow.
     const u32 surface_width = static_cast<u32>(config.surface_width_minus1) + 1;
@@ -153,21 +172,53 @@ void Vic::WriteRGBFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     const u32 width = std::min(surface_width, static_cast<u32>(frame_width));
     const u32 height = std::min(surface_height, static_cast<u32>(frame_height));
     const u32 blk_kind = static_cast<u32>(config.block_linear_kind);
+    const std::array<int, 4> converted_stride{frame_width * 4, 0, 0, 0};
+    auto& gmmu = host1x.GMMU();
+
+    if (blk_kind == 0 && width == static_cast<u32>(frame_width) &&
+        height == static_cast<u32>(frame_height)) {
+        // Pitch linear frames that fit the surface are converted straight into guest memory
+        const size_t linear_size = width * height * 4;
+        luma_buffer.resize_destructive(linear_size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            output(gmmu, output_surface_luma_address, linear_size, &luma_buffer);
+        u8* const output_addr{output.data()};
+        sws_scale(scaler, frame->GetPlanes(), frame->GetStrides(), 0, frame_height, &output_addr,
+                  converted_stride.data());
+        return;
+    }
+
+    const size_t frame_size = static_cast<size_t>(frame_width) * frame_height * 4;
+    if (!converted_frame_buffer || converted_frame_buffer_size < frame_size) {
+        converted_frame_buffer = AVMallocPtr{static_cast<u8*>(av_malloc(frame_size)), av_free};
+        converted_frame_buffer_size = frame_size;
+    }
+    u8* const converted_frame_buf_addr{converted_frame_buffer.get()};
+    sws_scale(scaler, frame->GetPlanes(), frame->GetStrides(), 0, frame_height,
+              &converted_frame_buf_addr, converted_stride.data());
+
+    const u32 src_pitch = static_cast<u32>(frame_width) * 4;
     if (blk_kind != 0) {
-        // swizzle pitch linear to block linear
+        // swizzle pitch linear to block linear, directly into the guest surface
         const u32 block_height = static_cast<u32>(config.block_linear_height_log2);
         const auto size = Texture::CalculateSize(true, 4, width, height, 1, block_height, 0);
         luma_buffer.resize_destructive(size);
-        std::span<const u8> frame_buff(converted_frame_buf_addr, 4 * width * height);
-        Texture::SwizzleSubrect(luma_buffer, frame_buff, 4, width, height, 1, 0, 0, width, height,
-                                block_height, 0, width * 4);
-
-        host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            output(gmmu, output_surface_luma_address, size, &luma_buffer);
+        std::span<const u8> frame_buff(converted_frame_buf_addr, frame_size);
+        Texture::SwizzleSubrect(output, frame_buff, 4, width, height, 1, 0, 0, width, height,
+                                block_height, 0, src_pitch);
     } else {
         // send pitch linear frame
-        const size_t linear_size = width * height * 4;
-        host1x.GMMU().WriteBlock(output_surface_luma_address, converted_frame_buf_addr,
-                                 linear_size);
+        const u32 dst_pitch = width * 4;
+        const size_t linear_size = static_cast<size_t>(dst_pitch) * height;
+        luma_buffer.resize_destructive(linear_size);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            output(gmmu, output_surface_luma_address, linear_size, &luma_buffer);
+        for (u32 y = 0; y < height; ++y) {
+            std::memcpy(output.data() + y * dst_pitch, converted_frame_buf_addr + y * src_pitch,
+                        dst_pitch);
+        }
     }
 }
 
@@ -180,40 +231,39 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
     // Use the minimum of surface/frame dimensions to avoid buffer overflow.
     const auto frame_width = std::min(surface_width, static_cast<size_t>(frame->GetWidth()));
     const auto frame_height = std::min(surface_height, static_cast<size_t>(frame->GetHeight()));
+    auto& gmmu = host1x.GMMU();
 
-    const auto stride = static_cast<size_t>(frame->GetStride(0));
-
-    luma_buffer.resize_destructive(aligned_width * surface_height);
-    chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
-
-    // Populate luma buffer
-    const u8* luma_src = frame->GetData(0);
-    for (std::size_t y = 0; y < frame_height; ++y) {
-        const std::size_t src = y * stride;
-        const std::size_t dst = y * aligned_width;
-        std::memcpy(luma_buffer.data() + dst, luma_src + src, frame_width);
+    // Populate luma plane, rows are copied straight into the guest surface
+    {
+        const auto stride = static_cast<size_t>(frame->GetStride(0));
+        const u8* luma_src = frame->GetData(0);
+        // The scratch buffer is only used when the surface is not contiguous in host memory
+        luma_buffer.resize_destructive(aligned_width * surface_height);
+        Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite>
+            luma(gmmu, output_surface_luma_address, luma_buffer.size(), &luma_buffer);
+        for (std::size_t y = 0; y < frame_height; ++y) {
+            std::memcpy(luma.data() + y * aligned_width, luma_src + y * stride, frame_width);
+        }
     }
-    host1x.GMMU().WriteBlock(output_surface_luma_address, luma_buffer.data(), luma_buffer.size());
 
     // Chroma
     const std::size_t half_height = frame_height / 2;
     const auto half_stride = static_cast<size_t>(frame->GetStride(1));
+    chroma_buffer.resize_destructive(aligned_width * surface_height / 2);
+    Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::SafeWrite> chroma(
+        gmmu, output_surface_chroma_address, chroma_buffer.size(), &chroma_buffer);
 
     switch (frame->GetPixelFormat()) {
     case AV_PIX_FMT_YUV420P: {
         // Frame from FFmpeg software
-        // Populate chroma buffer from both channels with interleaving.
+        // Populate chroma plane from both channels with interleaving.
         const std::size_t half_width = frame_width / 2;
-        u8* chroma_buffer_data = chroma_buffer.data();
         const u8* chroma_b_src = frame->GetData(1);
         const u8* chroma_r_src = frame->GetData(2);
         for (std::size_t y = 0; y < half_height; ++y) {
-            const std::size_t src = y * half_stride;
-            const std::size_t dst = y * aligned_width;
-            for (std::size_t x = 0; x < half_width; ++x) {
-                chroma_buffer_data[dst + x * 2] = chroma_b_src[src + x];
-                chroma_buffer_data[dst + x * 2 + 1] = chroma_r_src[src + x];
-            }
+            InterleaveChroma(chroma.data() + y * aligned_width, chroma_b_src + y * half_stride,
+                             chroma_r_src + y * static_cast<size_t>(frame->GetStride(2)),
+                             half_width);
         }
         break;
     }
@@ -222,9 +272,8 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         // This is already interleaved so just copy
         const u8* chroma_src = frame->GetData(1);
         for (std::size_t y = 0; y < half_height; ++y) {
-            const std::size_t src = y * stride;
-            const std::size_t dst = y * aligned_width;
-            std::memcpy(chroma_buffer.data() + dst, chroma_src + src, frame_width);
+            std::memcpy(chroma.data() + y * aligned_width, chroma_src + y * half_stride,
+                        frame_width);
         }
         break;
     }
@@ -232,8 +281,39 @@ void Vic::WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& c
         ASSERT(false);
         break;
     }
-    host1x.GMMU().WriteBlock(output_surface_chroma_address, chroma_buffer.data(),
-                             chroma_buffer.size());
+}
+
+SwsContext* Vic::GetScaler(s32 width, s32 height, s32 src_format, s32 dst_format) {
+    // Streams rarely change configuration, keep the last few to avoid recreating them
+    static constexpr size_t MAX_SCALERS = 4;
+
+    const auto it = std::ranges::find_if(scalers, [&](const Scaler& scaler) {
+        return scaler.width == width && scaler.height == height &&
+               scaler.src_format == src_format && scaler.dst_format == dst_format;
+    });
+    if (it != scalers.end()) {
+        if (it != std::prev(scalers.end())) {
+            std::rotate(it, std::next(it), scalers.end());
+        }
+        return scalers.back().context.get();
+    }
+    SwsContext* const context =
+        sws_getContext(width, height, static_cast<AVPixelFormat>(src_format), width, height,
+                       static_cast<AVPixelFormat>(dst_format), 0, nullptr, nullptr, nullptr);
+    if (!context) {
+        return nullptr;
+    }
+    if (scalers.size() == MAX_SCALERS) {
+        scalers.erase(scalers.begin());
+    }
+    scalers.push_back(Scaler{
+        .width = width,
+        .height = height,
+        .src_format = src_format,
+        .dst_format = dst_format,
+        .context{context, sws_freeContext},
+    });
+    return context;
 }
 
 } // namespace Host1x
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/scratch_buffer.h"
@@ -43,6 +44,17 @@ private:
 
     void WriteYUVFrame(std::unique_ptr<FFmpeg::Frame> frame, const VicConfig& config);
 
+    /// Returns a scaler converting frames of the given size and format, creating it if needed
+    SwsContext* GetScaler(s32 width, s32 height, s32 src_format, s32 dst_format);
+
+    struct Scaler {
+        s32 width;
+        s32 height;
+        s32 src_format;
+        s32 dst_format;
+        std::unique_ptr<SwsContext, void (*)(SwsContext*)> context;
+    };
+
     Host1x& host1x;
     std::shared_ptr<Tegra::Host1x::Nvdec> nvdec_processor;
 
@@ -50,6 +62,7 @@ private:
     /// size does not change during a stream
     using AVMallocPtr = std::unique_ptr<u8, decltype(&av_free)>;
     AVMallocPtr converted_frame_buffer;
+    size_t converted_frame_buffer_size{};
     Common::ScratchBuffer<u8> luma_buffer;
     Common::ScratchBuffer<u8> chroma_buffer;
 
@@ -57,9 +70,8 @@ private:
     GPUVAddr output_surface_luma_address{};
     GPUVAddr output_surface_chroma_address{};
 
-    SwsContext* scaler_ctx{};
-    s32 scaler_width{};
-    s32 scaler_height{};
+    /// Scalers of the most recently used configurations, the last one is the most recent
+    std::vector<Scaler> scalers;
 };
 
 } // namespace Host1x
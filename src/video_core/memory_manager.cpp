@@ -9,6 +9,7 @@
 #include "core/core.h"
 #include "core/hle/kernel/k_page_table.h"
 #include "core/hle/kernel/k_process.h"
+#include "video_core/gpu_trace.h"
 #include "video_core/guest_memory.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/invalidation_accumulator.h"
@@ -179,8 +180,22 @@ void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_)
     rasterizer = rasterizer_;
 }
 
+void MemoryManager::BindTraceRecorder(GpuTrace::Recorder* trace_recorder_) {
+    trace_recorder = trace_recorder_;
+}
+
 GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size, PTEKind kind,
                             bool is_big_pages) {
+    if (trace_recorder) [[unlikely]] {
+        ReleaseTracedMemory(gpu_addr, size);
+        if (is_big_pages) {
+            BigPageTableOp<EntryType::Mapped>(gpu_addr, dev_addr, size, kind);
+        } else {
+            PageTableOp<EntryType::Mapped>(gpu_addr, dev_addr, size, kind);
+        }
+        trace_recorder->RecordMap(*this, gpu_addr, dev_addr, size, kind, is_big_pages);
+        return gpu_addr;
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Mapped>(gpu_addr, dev_addr, size, kind);
     }
@@ -188,6 +203,10 @@ GPUVAddr MemoryManager::Map(GPUVAddr gpu_addr, DAddr dev_addr, std::size_t size,
 }
 
 GPUVAddr MemoryManager::MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages) {
+    if (trace_recorder) [[unlikely]] {
+        ReleaseTracedMemory(gpu_addr, size);
+        trace_recorder->RecordMapSparse(*this, gpu_addr, size, is_big_pages);
+    }
     if (is_big_pages) [[likely]] {
         return BigPageTableOp<EntryType::Reserved>(gpu_addr, 0, size, PTEKind::INVALID);
     }
@@ -203,12 +222,23 @@ void MemoryManager::Unmap(GPUVAddr gpu_addr, std::size_t size) {
     for (const auto& [map_addr, map_size] : page_stash) {
         rasterizer->UnmapMemory(map_addr, map_size);
     }
+    if (trace_recorder) [[unlikely]] {
+        trace_recorder->RecordUnmap(*this, gpu_addr, size);
+        trace_recorder->ReleaseMemory(std::span{page_stash.data(), page_stash.size()});
+    }
     page_stash.clear();
 
     BigPageTableOp<EntryType::Free>(gpu_addr, 0, size, PTEKind::INVALID);
     PageTableOp<EntryType::Free>(gpu_addr, 0, size, PTEKind::INVALID);
 }
 
+void MemoryManager::ReleaseTracedMemory(GPUVAddr gpu_addr, std::size_t size) {
+    // Remapping replaces what was mapped before, the old memory no longer has to be traced
+    GetSubmappedRangeImpl<false>(gpu_addr, size, page_stash);
+    trace_recorder->ReleaseMemory(std::span{page_stash.data(), page_stash.size()});
+    page_stash.clear();
+}
+
 std::optional<DAddr> MemoryManager::GpuToCpuAddress(GPUVAddr gpu_addr) const {
     if (!IsWithinGPUAddressRange(gpu_addr)) [[unlikely]] {
         return std::nullopt;
@@ -33,6 +33,10 @@ class System;
 
 namespace Tegra {
 
+namespace GpuTrace {
+class Recorder;
+}
+
 class MemoryManager final {
 public:
     explicit MemoryManager(Core::System& system_, u64 address_space_bits_ = 40,
@@ -47,9 +51,28 @@ public:
         return unique_identifier;
     }
 
+    u64 GetAddressSpaceBits() const {
+        return address_space_bits;
+    }
+
+    GPUVAddr GetSplitAddress() const {
+        return split_address;
+    }
+
+    u64 GetBigPageBits() const {
+        return big_page_bits;
+    }
+
+    u64 GetPageBits() const {
+        return page_bits;
+    }
+
     /// Binds a renderer to the memory manager.
     void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
 
+    /// Binds a GPU trace recorder, mapping changes are recorded to it from then on.
+    void BindTraceRecorder(GpuTrace::Recorder* trace_recorder);
+
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr) const;
 
     [[nodiscard]] std::optional<DAddr> GpuToCpuAddress(GPUVAddr addr, std::size_t size) const;
@@ -170,6 +193,8 @@ private:
     void WriteBlockImpl(GPUVAddr gpu_dest_addr, const void* src_buffer, std::size_t size,
                         VideoCommon::CacheType which);
 
+    void ReleaseTracedMemory(GPUVAddr gpu_addr, std::size_t size);
+
     template <bool is_big_page>
     [[nodiscard]] std::size_t PageEntryIndex(GPUVAddr gpu_addr) const {
         if constexpr (is_big_page) {
@@ -245,6 +270,7 @@ private:
 
     const size_t unique_identifier;
     std::unique_ptr<VideoCommon::InvalidationAccumulator> accumulator;
+    GpuTrace::Recorder* trace_recorder{};
 
     static std::atomic<size_t> unique_identifier_generator;
 
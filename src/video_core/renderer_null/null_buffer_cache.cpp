@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "video_core/renderer_null/null_buffer_cache.h"
+
+namespace Null {
+
+Buffer::Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params)
+    : VideoCommon::BufferBase(null_params) {}
+
+Buffer::Buffer(BufferCacheRuntime&, DAddr cpu_addr_, u64 size_bytes_)
+    : VideoCommon::BufferBase(cpu_addr_, size_bytes_), storage(SizeBytes()) {}
+
+void Buffer::ImmediateUpload(size_t offset, std::span<const u8> data) noexcept {
+    std::memcpy(storage.data() + offset, data.data(), data.size_bytes());
+}
+
+void Buffer::ImmediateDownload(size_t offset, std::span<u8> data) noexcept {
+    std::memcpy(data.data(), storage.data() + offset, data.size_bytes());
+}
+
+BufferCacheRuntime::BufferCacheRuntime(StagingBufferPool& staging_pool_)
+    : staging_pool{staging_pool_} {}
+
+StagingBufferMap BufferCacheRuntime::UploadStagingBuffer(size_t size) {
+    return staging_pool.Request(size);
+}
+
+StagingBufferMap BufferCacheRuntime::DownloadStagingBuffer(size_t size, bool) {
+    return staging_pool.Request(size);
+}
+
+void BufferCacheRuntime::FreeDeferredStagingBuffer(StagingBufferMap& map) {
+    staging_pool.Free(map);
+}
+
+void BufferCacheRuntime::CopyBuffer(std::span<u8> dst_buffer, std::span<u8> src_buffer,
+                                    std::span<const VideoCommon::BufferCopy> copies, bool, bool) {
+    for (const VideoCommon::BufferCopy& copy : copies) {
+        std::memmove(dst_buffer.data() + copy.dst_offset, src_buffer.data() + copy.src_offset,
+                     copy.size);
+    }
+}
+
+void BufferCacheRuntime::ClearBuffer(Buffer& dest_buffer, u32 offset, size_t size, u32 value) {
+    const std::span<u8> storage{dest_buffer};
+    for (size_t index = 0; index < size; index += sizeof(u32)) {
+        std::memcpy(storage.data() + offset + index, &value,
+                    std::min(sizeof(u32), size - index));
+    }
+}
+
+} // namespace Null
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/scratch_buffer.h"
+#include "video_core/buffer_cache/buffer_cache_base.h"
+#include "video_core/buffer_cache/memory_tracker_base.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/renderer_null/null_staging_buffer_pool.h"
+#include "video_core/surface.h"
+
+namespace Null {
+
+class BufferCacheRuntime;
+
+/// Buffer backed by host memory, it keeps the contents uploaded to it so downloads return them
+class Buffer : public VideoCommon::BufferBase {
+public:
+    explicit Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params);
+    explicit Buffer(BufferCacheRuntime&, DAddr cpu_addr_, u64 size_bytes_);
+
+    void ImmediateUpload(size_t offset, std::span<const u8> data) noexcept;
+
+    void ImmediateDownload(size_t offset, std::span<u8> data) noexcept;
+
+    void MarkUsage(u64 offset, u64 size) noexcept {}
+
+    operator std::span<u8>() noexcept {
+        return storage;
+    }
+
+private:
+    std::vector<u8> storage;
+};
+
+class BufferCacheRuntime {
+    using PrimitiveTopology = Tegra::Engines::Maxwell3D::Regs::PrimitiveTopology;
+    using IndexFormat = Tegra::Engines::Maxwell3D::Regs::IndexFormat;
+
+public:
+    explicit BufferCacheRuntime(StagingBufferPool& staging_pool_);
+
+    void TickFrame(Common::SlotVector<Buffer>&) noexcept {}
+
+    void Finish() {}
+
+    u64 GetDeviceLocalMemory() const {
+        return 0;
+    }
+
+    u64 GetDeviceMemoryUsage() const {
+        return 0;
+    }
+
+    bool CanReportMemoryUsage() const {
+        return false;
+    }
+
+    u32 GetStorageBufferAlignment() const {
+        return 16;
+    }
+
+    [[nodiscard]] StagingBufferMap UploadStagingBuffer(size_t size);
+
+    [[nodiscard]] StagingBufferMap DownloadStagingBuffer(size_t size, bool deferred = false);
+
+    bool CanReorderUpload(const Buffer&, std::span<const VideoCommon::BufferCopy>) {
+        return false;
+    }
+
+    void FreeDeferredStagingBuffer(StagingBufferMap& map);
+
+    void PreCopyBarrier() {}
+
+    void CopyBuffer(std::span<u8> dst_buffer, std::span<u8> src_buffer,
+                    std::span<const VideoCommon::BufferCopy> copies, bool barrier,
+                    bool can_reorder_upload = false);
+
+    void PostCopyBarrier() {}
+
+    void ClearBuffer(Buffer& dest_buffer, u32 offset, size_t size, u32 value);
+
+    void BindIndexBuffer(PrimitiveTopology, IndexFormat, u32, u32, Buffer&, u32, u32) {}
+
+    void BindQuadIndexBuffer(PrimitiveTopology, u32, u32) {}
+
+    void BindVertexBuffer(u32, Buffer&, u32, u32, u32) {}
+
+    void BindVertexBuffers(VideoCommon::HostBindings<Buffer>&) {}
+
+    void BindTransformFeedbackBuffer(u32, Buffer&, u32, u32) {}
+
+    void BindTransformFeedbackBuffers(VideoCommon::HostBindings<Buffer>&) {}
+
+    std::span<u8> BindMappedUniformBuffer(size_t, u32, u32 size) {
+        uniform_scratch.resize_destructive(size);
+        return std::span(uniform_scratch.data(), size);
+    }
+
+    void BindUniformBuffer(Buffer&, u32, u32) {}
+
+    void BindStorageBuffer(Buffer&, u32, u32, bool) {}
+
+    void BindTextureBuffer(Buffer&, u32, u32, VideoCore::Surface::PixelFormat) {}
+
+private:
+    StagingBufferPool& staging_pool;
+    Common::ScratchBuffer<u8> uniform_scratch;
+};
+
+struct BufferCacheParams {
+    using Runtime = Null::BufferCacheRuntime;
+    using Buffer = Null::Buffer;
+    using Async_Buffer = Null::StagingBufferMap;
+    using MemoryTracker = VideoCommon::MemoryTrackerBase<Tegra::MaxwellDeviceMemoryManager>;
+
+    static constexpr bool IS_OPENGL = false;
+    static constexpr bool HAS_PERSISTENT_UNIFORM_BUFFER_BINDINGS = false;
+    static constexpr bool HAS_FULL_INDEX_AND_PRIMITIVE_SUPPORT = false;
+    static constexpr bool NEEDS_BIND_UNIFORM_INDEX = false;
+    static constexpr bool NEEDS_BIND_STORAGE_INDEX = false;
+    static constexpr bool USE_MEMORY_MAPS = true;
+    static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
+    static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool CAN_IMPORT_HOST_MEMORY = false;
+};
+
+using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
+
+} // namespace Null
@@ -0,0 +1,605 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+#include "common/alignment.h"
+#include "common/cityhash.h"
+#include "common/container_hash.h"
+#include "common/logging/log.h"
+#include "common/scope_exit.h"
+#include "common/settings.h"
+#include "video_core/control/channel_state.h"
+#include "video_core/engines/draw_manager.h"
+#include "video_core/engines/kepler_compute.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/gpu.h"
+#include "video_core/host1x/host1x.h"
+#include "video_core/memory_manager.h"
+#include "video_core/renderer_null/null_simulated_rasterizer.h"
+
+namespace Null {
+namespace {
+
+/// Logs the statistics every this many frames
+constexpr u64 STATS_LOG_INTERVAL = 600;
+
+/// Accumulates the time spent in its scope
+class ScopedTimer {
+public:
+    explicit ScopedTimer(std::chrono::nanoseconds& total_)
+        : total{total_}, start{std::chrono::steady_clock::now()} {}
+
+    ~ScopedTimer() {
+        total += std::chrono::steady_clock::now() - start;
+    }
+
+private:
+    std::chrono::nanoseconds& total;
+    std::chrono::steady_clock::time_point start;
+};
+
+template <typename Key>
+KeyLookup FindOrInsert(std::unordered_map<size_t, std::vector<Key>>& keys, size_t hash,
+                       const Key& key) {
+    auto& bucket = keys[hash];
+    if (std::ranges::find(bucket, key) != bucket.end()) {
+        return KeyLookup::Hit;
+    }
+    bucket.push_back(key);
+    return KeyLookup::Miss;
+}
+
+} // Anonymous namespace
+
+PipelineKeyCache::PipelineKeyCache(Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : VideoCommon::ShaderCache{device_memory_} {
+    // No dynamic state is assumed, so every register the key covers is part of it
+    for (size_t group = 0; group < Vulkan::FixedPipelineState::NumHashGroups; ++group) {
+        graphics_key_group_hashes[group] = graphics_key.state.GroupHash(
+            static_cast<Vulkan::FixedPipelineState::HashGroup>(group));
+    }
+}
+
+bool PipelineKeyCache::GraphicsKey::operator==(const GraphicsKey& rhs) const noexcept {
+    return std::memcmp(&rhs, this, Size()) == 0;
+}
+
+bool PipelineKeyCache::ComputeKey::operator==(const ComputeKey& rhs) const noexcept {
+    return std::memcmp(&rhs, this, sizeof *this) == 0;
+}
+
+KeyLookup PipelineKeyCache::RefreshGraphicsKey() {
+    if (!RefreshStages(graphics_key.unique_hashes)) {
+        return KeyLookup::Invalid;
+    }
+    const u32 refreshed_groups{graphics_key.state.Refresh(*maxwell3d, dynamic_features)};
+    for (u32 groups = refreshed_groups; groups != 0; groups &= groups - 1) {
+        const auto group{
+            static_cast<Vulkan::FixedPipelineState::HashGroup>(std::countr_zero(groups))};
+        graphics_key_group_hashes[group] = graphics_key.state.GroupHash(group);
+    }
+    const auto& unique_hashes{graphics_key.unique_hashes};
+    size_t hash = graphics_key.state.Hash(graphics_key_group_hashes);
+    Common::HashCombine(hash, Common::CityHash64(reinterpret_cast<const char*>(&unique_hashes),
+                                                 sizeof(unique_hashes)));
+    return FindOrInsert(graphics_keys, hash, graphics_key);
+}
+
+KeyLookup PipelineKeyCache::RefreshComputeKey() {
+    const VideoCommon::ShaderInfo* const shader{ComputeShader()};
+    if (!shader) {
+        return KeyLookup::Invalid;
+    }
+    const auto& qmd{kepler_compute->launch_description};
+    const ComputeKey key{
+        .unique_hash = shader->unique_hash,
+        .shared_memory_size = qmd.shared_alloc,
+        .workgroup_size{qmd.block_dim_x, qmd.block_dim_y, qmd.block_dim_z},
+    };
+    const size_t hash = Common::CityHash64(reinterpret_cast<const char*>(&key), sizeof(key));
+    return FindOrInsert(compute_keys, hash, key);
+}
+
+SimulatedAccelerateDMA::SimulatedAccelerateDMA(BufferCache& buffer_cache_)
+    : buffer_cache{buffer_cache_} {}
+
+bool SimulatedAccelerateDMA::BufferCopy(GPUVAddr src_address, GPUVAddr dest_address, u64 amount) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMACopy(src_address, dest_address, amount);
+}
+
+bool SimulatedAccelerateDMA::BufferClear(GPUVAddr src_address, u64 amount, u32 value) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    return buffer_cache.DMAClear(src_address, amount, value);
+}
+
+SimulatedRasterizer::SimulatedRasterizer(Tegra::GPU& gpu_,
+                                         Tegra::MaxwellDeviceMemoryManager& device_memory_)
+    : gpu{gpu_}, texture_cache_runtime{staging_buffer_pool},
+      texture_cache{texture_cache_runtime, device_memory_},
+      buffer_cache_runtime{staging_buffer_pool}, buffer_cache{device_memory_, buffer_cache_runtime},
+      pipeline_key_cache{device_memory_}, accelerate_dma{buffer_cache} {
+    // Without shader information, let bound uniform buffers be used whole
+    for (auto& stage_sizes : uniform_buffer_sizes) {
+        stage_sizes.fill(std::numeric_limits<u32>::max());
+    }
+    compute_uniform_buffer_sizes.fill(std::numeric_limits<u32>::max());
+    LOG_INFO(Render, "Simulating the GPU caches on the null renderer");
+}
+
+SimulatedRasterizer::~SimulatedRasterizer() {
+    LogStats();
+}
+
+void SimulatedRasterizer::Draw(bool is_indexed, u32 instance_count) {
+    PrepareDraw(is_indexed);
+}
+
+void SimulatedRasterizer::DrawIndirect() {
+    const auto& params = maxwell3d->draw_manager->GetIndirectParams();
+    buffer_cache.SetDrawIndirect(&params);
+    PrepareDraw(params.is_indexed);
+    if (!params.is_byte_count) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        if (params.include_count) {
+            static_cast<void>(buffer_cache.GetDrawIndirectCount());
+        }
+        static_cast<void>(buffer_cache.GetDrawIndirectBuffer());
+    }
+    buffer_cache.SetDrawIndirect(nullptr);
+}
+
+void SimulatedRasterizer::DrawTexture() {
+    SCOPE_EXIT {
+        gpu.TickWork();
+    };
+    ++stats.draws;
+
+    std::scoped_lock lock{texture_cache.mutex};
+    ScopedTimer timer{stats.texture_cache_time};
+    texture_cache.SynchronizeGraphicsDescriptors();
+    texture_cache.UpdateRenderTargets(false);
+
+    const auto& draw_texture_state = maxwell3d->draw_manager->GetDrawTextureState();
+    static_cast<void>(texture_cache.GetGraphicsSampler(draw_texture_state.src_sampler));
+    static_cast<void>(texture_cache.GetImageView(draw_texture_state.src_texture));
+    static_cast<void>(texture_cache.GetFramebuffer());
+}
+
+void SimulatedRasterizer::PrepareDraw(bool is_indexed) {
+    SCOPE_EXIT {
+        gpu.TickWork();
+    };
+    gpu_memory->FlushCaching();
+    ++stats.draws;
+
+    KeyLookup lookup;
+    {
+        ScopedTimer timer{stats.pipeline_key_time};
+        lookup = pipeline_key_cache.RefreshGraphicsKey();
+    }
+    if (lookup == KeyLookup::Invalid) {
+        return;
+    }
+    ++(lookup == KeyLookup::Hit ? stats.graphics_key_hits : stats.graphics_key_misses);
+
+    gpu.TickWork();
+
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    {
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.SynchronizeGraphicsDescriptors();
+    }
+    {
+        ScopedTimer timer{stats.buffer_cache_time};
+        ConfigureGraphicsBuffers(is_indexed);
+    }
+    {
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.UpdateRenderTargets(false);
+        static_cast<void>(texture_cache.GetFramebuffer());
+    }
+}
+
+void SimulatedRasterizer::ConfigureGraphicsBuffers(bool is_indexed) {
+    const auto& regs{maxwell3d->regs};
+    std::array<u32, VideoCommon::NUM_STAGES> enabled_uniform_buffer_masks{};
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        // Stages are offset by one from programs, VertexA is merged into VertexB
+        if (!regs.IsShaderConfigEnabled(stage + 1)) {
+            continue;
+        }
+        const auto& const_buffers{maxwell3d->state.shader_stages[stage].const_buffers};
+        for (size_t index = 0; index < const_buffers.size(); ++index) {
+            if (const_buffers[index].enabled) {
+                enabled_uniform_buffer_masks[stage] |= 1U << index;
+            }
+        }
+    }
+    buffer_cache.SetUniformBuffersState(enabled_uniform_buffer_masks, &uniform_buffer_sizes);
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        buffer_cache.UnbindGraphicsStorageBuffers(stage);
+        buffer_cache.UnbindGraphicsTextureBuffers(stage);
+    }
+    buffer_cache.UpdateGraphicsBuffers(is_indexed);
+    buffer_cache.BindHostGeometryBuffers(is_indexed);
+    for (size_t stage = 0; stage < VideoCommon::NUM_STAGES; ++stage) {
+        if (enabled_uniform_buffer_masks[stage] != 0) {
+            buffer_cache.BindHostStageBuffers(stage);
+        }
+    }
+}
+
+void SimulatedRasterizer::Clear(u32 layer_count) {
+    gpu_memory->FlushCaching();
+    const auto& regs = maxwell3d->regs;
+    const bool use_color = regs.clear_surface.R || regs.clear_surface.G ||
+                           regs.clear_surface.B || regs.clear_surface.A;
+    if (!use_color && !regs.clear_surface.Z && !regs.clear_surface.S) {
+        return;
+    }
+    ++stats.clears;
+
+    std::scoped_lock lock{texture_cache.mutex};
+    ScopedTimer timer{stats.texture_cache_time};
+    texture_cache.UpdateRenderTargets(true);
+    static_cast<void>(texture_cache.GetFramebuffer());
+}
+
+void SimulatedRasterizer::DispatchCompute() {
+    gpu_memory->FlushCaching();
+    ++stats.dispatches;
+
+    KeyLookup lookup;
+    {
+        ScopedTimer timer{stats.pipeline_key_time};
+        lookup = pipeline_key_cache.RefreshComputeKey();
+    }
+    if (lookup == KeyLookup::Invalid) {
+        return;
+    }
+    ++(lookup == KeyLookup::Hit ? stats.compute_key_hits : stats.compute_key_misses);
+
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    const auto& qmd{kepler_compute->launch_description};
+    {
+        ScopedTimer timer{stats.buffer_cache_time};
+        buffer_cache.SetComputeUniformBufferState(qmd.const_buffer_enable_mask,
+                                                  &compute_uniform_buffer_sizes);
+        buffer_cache.UnbindComputeStorageBuffers();
+        buffer_cache.UnbindComputeTextureBuffers();
+    }
+    {
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.SynchronizeComputeDescriptors();
+    }
+    ScopedTimer timer{stats.buffer_cache_time};
+    buffer_cache.UpdateComputeBuffers();
+    buffer_cache.BindHostComputeBuffers();
+    if (const auto indirect_address = kepler_compute->GetIndirectComputeAddress()) {
+        static constexpr auto sync_info = VideoCommon::ObtainBufferSynchronize::FullSynchronize;
+        static constexpr auto post_op = VideoCommon::ObtainBufferOperation::DiscardWrite;
+        static_cast<void>(buffer_cache.ObtainBuffer(*indirect_address, 12, sync_info, post_op));
+    }
+}
+
+void SimulatedRasterizer::ResetCounter(VideoCommon::QueryType type) {}
+
+void SimulatedRasterizer::Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
+                                VideoCommon::QueryPropertiesFlags flags, u32 payload,
+                                u32 subreport) {
+    if (!gpu_memory) {
+        return;
+    }
+    if (True(flags & VideoCommon::QueryPropertiesFlags::HasTimeout)) {
+        u64 ticks = gpu.GetTicks();
+        gpu_memory->Write<u64>(gpu_addr + 8, ticks);
+        gpu_memory->Write<u64>(gpu_addr, static_cast<u64>(payload));
+    } else {
+        gpu_memory->Write<u32>(gpu_addr, payload);
+    }
+}
+
+void SimulatedRasterizer::BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr,
+                                                    u32 size) {
+    std::scoped_lock lock{buffer_cache.mutex};
+    ScopedTimer timer{stats.buffer_cache_time};
+    buffer_cache.BindGraphicsUniformBuffer(stage, index, gpu_addr, size);
+}
+
+void SimulatedRasterizer::DisableGraphicsUniformBuffer(size_t stage, u32 index) {
+    buffer_cache.DisableGraphicsUniformBuffer(stage, index);
+}
+
+void SimulatedRasterizer::FlushAll() {}
+
+void SimulatedRasterizer::FlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.DownloadMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        buffer_cache.DownloadMemory(addr, size);
+    }
+}
+
+bool SimulatedRasterizer::MustFlushRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        if (buffer_cache.IsRegionGpuModified(addr, size)) {
+            return true;
+        }
+    }
+    if (!Settings::IsGPULevelHigh()) {
+        return false;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        return texture_cache.IsRegionGpuModified(addr, size);
+    }
+    return false;
+}
+
+void SimulatedRasterizer::InvalidateRegion(DAddr addr, u64 size, VideoCommon::CacheType which) {
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    if (True(which & VideoCommon::CacheType::TextureCache)) {
+        std::scoped_lock lock{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.WriteMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::BufferCache)) {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    if (True(which & VideoCommon::CacheType::ShaderCache)) {
+        pipeline_key_cache.InvalidateRegion(addr, size);
+    }
+}
+
+void SimulatedRasterizer::OnCacheInvalidation(DAddr addr, u64 size) {
+    if (addr == 0 || size == 0) {
+        return;
+    }
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.WriteMemory(addr, size);
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    pipeline_key_cache.InvalidateRegion(addr, size);
+}
+
+bool SimulatedRasterizer::OnCPUWrite(DAddr addr, u64 size) {
+    if (addr == 0 || size == 0) {
+        return false;
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        if (buffer_cache.OnCPUWrite(addr, size)) {
+            return true;
+        }
+    }
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.WriteMemory(addr, size);
+    }
+    pipeline_key_cache.InvalidateRegion(addr, size);
+    return false;
+}
+
+VideoCore::RasterizerDownloadArea SimulatedRasterizer::GetFlushArea(DAddr addr, u64 size) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        auto area = texture_cache.GetFlushArea(addr, size);
+        if (area) {
+            return *area;
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        auto area = buffer_cache.GetFlushArea(addr, size);
+        if (area) {
+            return *area;
+        }
+    }
+    VideoCore::RasterizerDownloadArea new_area{
+        .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
+        .end_address = Common::AlignUp(addr + size, Core::DEVICE_PAGESIZE),
+        .preemtive = true,
+    };
+    return new_area;
+}
+
+void SimulatedRasterizer::InvalidateGPUCache() {
+    gpu.InvalidateGPUCache();
+}
+
+void SimulatedRasterizer::UnmapMemory(DAddr addr, u64 size) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        texture_cache.UnmapMemory(addr, size);
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        buffer_cache.WriteMemory(addr, size);
+    }
+    pipeline_key_cache.OnCacheInvalidation(addr, size);
+}
+
+void SimulatedRasterizer::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {
+    std::scoped_lock lock{texture_cache.mutex};
+    texture_cache.UnmapGPUMemory(as_id, addr, size);
+}
+
+void SimulatedRasterizer::SignalFence(std::function<void()>&& func) {
+    // There is no host GPU to wait for, fences are signaled as soon as the flushes are done
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        texture_cache.CommitAsyncFlushes();
+        buffer_cache.CommitAsyncFlushes();
+        texture_cache.PopAsyncFlushes();
+        buffer_cache.PopAsyncFlushes();
+    }
+    func();
+}
+
+void SimulatedRasterizer::SyncOperation(std::function<void()>&& func) {
+    func();
+}
+
+void SimulatedRasterizer::SignalSyncPoint(u32 value) {
+    auto& syncpoint_manager = gpu.Host1x().GetSyncpointManager();
+    syncpoint_manager.IncrementGuest(value);
+    SignalFence([&syncpoint_manager, value] { syncpoint_manager.IncrementHost(value); });
+}
+
+void SimulatedRasterizer::SignalReference() {
+    std::scoped_lock lock{buffer_cache.mutex};
+    buffer_cache.AccumulateFlushes();
+}
+
+void SimulatedRasterizer::ReleaseFences(bool) {}
+
+void SimulatedRasterizer::FlushAndInvalidateRegion(DAddr addr, u64 size,
+                                                   VideoCommon::CacheType which) {
+    if (Settings::IsGPULevelExtreme()) {
+        FlushRegion(addr, size, which);
+    }
+    InvalidateRegion(addr, size, which);
+}
+
+void SimulatedRasterizer::WaitForIdle() {
+    SignalReference();
+}
+
+void SimulatedRasterizer::FragmentBarrier() {}
+
+void SimulatedRasterizer::TiledCacheBarrier() {}
+
+void SimulatedRasterizer::FlushCommands() {}
+
+void SimulatedRasterizer::TickFrame() {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.TickFrame();
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        buffer_cache.TickFrame();
+    }
+    if (++frame_count % STATS_LOG_INTERVAL == 0) {
+        LogStats();
+    }
+}
+
+bool SimulatedRasterizer::AccelerateSurfaceCopy(
+    const Tegra::Engines::Fermi2D::Surface& src, const Tegra::Engines::Fermi2D::Surface& dst,
+    const Tegra::Engines::Fermi2D::Config& copy_config) {
+    std::scoped_lock lock{texture_cache.mutex};
+    ScopedTimer timer{stats.texture_cache_time};
+    return texture_cache.BlitImage(dst, src, copy_config);
+}
+
+Tegra::Engines::AccelerateDMAInterface& SimulatedRasterizer::AccessAccelerateDMA() {
+    return accelerate_dma;
+}
+
+void SimulatedRasterizer::AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
+                                                   std::span<const u8> memory) {
+    auto cpu_addr = gpu_memory->GpuToCpuAddress(address);
+    if (!cpu_addr) [[unlikely]] {
+        gpu_memory->WriteBlock(address, memory.data(), copy_size);
+        return;
+    }
+    gpu_memory->WriteBlockUnsafe(address, memory.data(), copy_size);
+    {
+        std::unique_lock<std::recursive_mutex> lock{buffer_cache.mutex};
+        ScopedTimer timer{stats.buffer_cache_time};
+        if (!buffer_cache.InlineMemory(*cpu_addr, copy_size, memory)) {
+            buffer_cache.WriteMemory(*cpu_addr, copy_size);
+        }
+    }
+    {
+        std::scoped_lock lock_texture{texture_cache.mutex};
+        ScopedTimer timer{stats.texture_cache_time};
+        texture_cache.WriteMemory(*cpu_addr, copy_size);
+    }
+    pipeline_key_cache.InvalidateRegion(*cpu_addr, copy_size);
+}
+
+void SimulatedRasterizer::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
+                                            const VideoCore::DiskResourceLoadCallback& callback) {}
+
+void SimulatedRasterizer::InitializeChannel(Tegra::Control::ChannelState& channel) {
+    CreateChannel(channel);
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.CreateChannel(channel);
+        buffer_cache.CreateChannel(channel);
+    }
+    pipeline_key_cache.CreateChannel(channel);
+    state_tracker.SetupTables(channel);
+}
+
+void SimulatedRasterizer::BindChannel(Tegra::Control::ChannelState& channel) {
+    const s32 channel_id = channel.bind_id;
+    BindToChannel(channel_id);
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.BindToChannel(channel_id);
+        buffer_cache.BindToChannel(channel_id);
+    }
+    pipeline_key_cache.BindToChannel(channel_id);
+    state_tracker.ChangeChannel(channel);
+    state_tracker.InvalidateState();
+}
+
+void SimulatedRasterizer::ReleaseChannel(s32 channel_id) {
+    EraseChannel(channel_id);
+    {
+        std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+        texture_cache.EraseChannel(channel_id);
+        buffer_cache.EraseChannel(channel_id);
+    }
+    pipeline_key_cache.EraseChannel(channel_id);
+}
+
+void SimulatedRasterizer::LogStats() const {
+    const auto to_ms = [](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    };
+    LOG_INFO(Render,
+             "Simulated GPU after {} frames: {} draws, {} clears, {} dispatches, "
+             "graphics keys {} hits / {} misses, compute keys {} hits / {} misses, "
+             "pipeline keys {:.2f} ms, buffer cache {:.2f} ms, texture cache {:.2f} ms",
+             frame_count, stats.draws, stats.clears, stats.dispatches, stats.graphics_key_hits,
+             stats.graphics_key_misses, stats.compute_key_hits, stats.compute_key_misses,
+             to_ms(stats.pipeline_key_time), to_ms(stats.buffer_cache_time),
+             to_ms(stats.texture_cache_time));
+}
+
+} // namespace Null
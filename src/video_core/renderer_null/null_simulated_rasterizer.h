@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/buffer_cache/buffer_cache_base.h"
+#include "video_core/control/channel_state_cache.h"
+#include "video_core/engines/maxwell_dma.h"
+#include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_null/null_buffer_cache.h"
+#include "video_core/renderer_null/null_staging_buffer_pool.h"
+#include "video_core/renderer_null/null_texture_cache.h"
+#include "video_core/renderer_vulkan/fixed_pipeline_state.h"
+#include "video_core/renderer_vulkan/vk_state_tracker.h"
+#include "video_core/shader_cache.h"
+
+namespace Tegra {
+class GPU;
+}
+
+namespace Null {
+
+/// Counters and timers of the work done by the simulated renderer
+struct SimulationStats {
+    u64 draws{};
+    u64 clears{};
+    u64 dispatches{};
+    u64 graphics_key_hits{};
+    u64 graphics_key_misses{};
+    u64 compute_key_hits{};
+    u64 compute_key_misses{};
+    std::chrono::nanoseconds pipeline_key_time{};
+    std::chrono::nanoseconds buffer_cache_time{};
+    std::chrono::nanoseconds texture_cache_time{};
+};
+
+enum class KeyLookup {
+    Invalid,
+    Hit,
+    Miss,
+};
+
+/// Computes the keys the Vulkan renderer looks its pipelines up with, without building anything
+class PipelineKeyCache final : public VideoCommon::ShaderCache {
+public:
+    explicit PipelineKeyCache(Tegra::MaxwellDeviceMemoryManager& device_memory_);
+
+    KeyLookup RefreshGraphicsKey();
+
+    KeyLookup RefreshComputeKey();
+
+private:
+    struct GraphicsKey {
+        std::array<u64, 6> unique_hashes;
+        Vulkan::FixedPipelineState state;
+
+        size_t Size() const noexcept {
+            return sizeof(unique_hashes) + state.Size();
+        }
+
+        bool operator==(const GraphicsKey& rhs) const noexcept;
+    };
+
+    struct ComputeKey {
+        u64 unique_hash;
+        u32 shared_memory_size;
+        std::array<u32, 3> workgroup_size;
+
+        bool operator==(const ComputeKey& rhs) const noexcept;
+    };
+
+    Vulkan::DynamicFeatures dynamic_features{};
+    GraphicsKey graphics_key{};
+    std::array<u64, Vulkan::FixedPipelineState::NumHashGroups> graphics_key_group_hashes{};
+
+    std::unordered_map<size_t, std::vector<GraphicsKey>> graphics_keys;
+    std::unordered_map<size_t, std::vector<ComputeKey>> compute_keys;
+};
+
+class SimulatedAccelerateDMA : public Tegra::Engines::AccelerateDMAInterface {
+public:
+    explicit SimulatedAccelerateDMA(BufferCache& buffer_cache);
+
+    bool BufferCopy(GPUVAddr start_address, GPUVAddr end_address, u64 amount) override;
+    bool BufferClear(GPUVAddr src_address, u64 amount, u32 value) override;
+    bool ImageToBuffer(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::ImageOperand& src,
+                       const Tegra::DMA::BufferOperand& dst) override {
+        return false;
+    }
+    bool BufferToImage(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& src,
+                       const Tegra::DMA::ImageOperand& dst) override {
+        return false;
+    }
+
+private:
+    BufferCache& buffer_cache;
+};
+
+/**
+ * Rasterizer running the buffer cache, the texture cache and the pipeline key computation of the
+ * hardware renderers against runtimes that do no host GPU work. It measures the cost of the
+ * emulation side of rendering on machines without a GPU.
+ *
+ * Shaders are never translated, so the resources a draw uses are approximated: every uniform
+ * buffer enabled on an active stage is bound, and sampled textures, images and storage buffers
+ * are not bound at all.
+ */
+class SimulatedRasterizer final
+    : public VideoCore::RasterizerInterface,
+      protected VideoCommon::ChannelSetupCaches<VideoCommon::ChannelInfo> {
+public:
+    explicit SimulatedRasterizer(Tegra::GPU& gpu, Tegra::MaxwellDeviceMemoryManager& device_memory);
+    ~SimulatedRasterizer() override;
+
+    void Draw(bool is_indexed, u32 instance_count) override;
+    void DrawIndirect() override;
+    void DrawTexture() override;
+    void Clear(u32 layer_count) override;
+    void DispatchCompute() override;
+    void ResetCounter(VideoCommon::QueryType type) override;
+    void Query(GPUVAddr gpu_addr, VideoCommon::QueryType type,
+               VideoCommon::QueryPropertiesFlags flags, u32 payload, u32 subreport) override;
+    void BindGraphicsUniformBuffer(size_t stage, u32 index, GPUVAddr gpu_addr, u32 size) override;
+    void DisableGraphicsUniformBuffer(size_t stage, u32 index) override;
+    void FlushAll() override;
+    void FlushRegion(DAddr addr, u64 size,
+                     VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
+    bool MustFlushRegion(DAddr addr, u64 size,
+                         VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
+    void InvalidateRegion(DAddr addr, u64 size,
+                          VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
+    void OnCacheInvalidation(DAddr addr, u64 size) override;
+    bool OnCPUWrite(DAddr addr, u64 size) override;
+    VideoCore::RasterizerDownloadArea GetFlushArea(DAddr addr, u64 size) override;
+    void InvalidateGPUCache() override;
+    void UnmapMemory(DAddr addr, u64 size) override;
+    void ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) override;
+    void SignalFence(std::function<void()>&& func) override;
+    void SyncOperation(std::function<void()>&& func) override;
+    void SignalSyncPoint(u32 value) override;
+    void SignalReference() override;
+    void ReleaseFences(bool force) override;
+    void FlushAndInvalidateRegion(
+        DAddr addr, u64 size, VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
+    void WaitForIdle() override;
+    void FragmentBarrier() override;
+    void TiledCacheBarrier() override;
+    void FlushCommands() override;
+    void TickFrame() override;
+    bool AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Surface& src,
+                               const Tegra::Engines::Fermi2D::Surface& dst,
+                               const Tegra::Engines::Fermi2D::Config& copy_config) override;
+    Tegra::Engines::AccelerateDMAInterface& AccessAccelerateDMA() override;
+    void AccelerateInlineToMemory(GPUVAddr address, size_t copy_size,
+                                  std::span<const u8> memory) override;
+    void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
+                           const VideoCore::DiskResourceLoadCallback& callback) override;
+    void InitializeChannel(Tegra::Control::ChannelState& channel) override;
+    void BindChannel(Tegra::Control::ChannelState& channel) override;
+    void ReleaseChannel(s32 channel_id) override;
+
+    [[nodiscard]] const SimulationStats& Stats() const noexcept {
+        return stats;
+    }
+
+private:
+    void PrepareDraw(bool is_indexed);
+
+    void ConfigureGraphicsBuffers(bool is_indexed);
+
+    void LogStats() const;
+
+    Tegra::GPU& gpu;
+
+    StagingBufferPool staging_buffer_pool;
+    TextureCacheRuntime texture_cache_runtime;
+    TextureCache texture_cache;
+    BufferCacheRuntime buffer_cache_runtime;
+    BufferCache buffer_cache;
+    PipelineKeyCache pipeline_key_cache;
+    Vulkan::StateTracker state_tracker;
+    SimulatedAccelerateDMA accelerate_dma;
+
+    VideoCommon::UniformBufferSizes uniform_buffer_sizes{};
+    VideoCommon::ComputeUniformBufferSizes compute_uniform_buffer_sizes{};
+
+    SimulationStats stats;
+    u64 frame_count{};
+};
+
+} // namespace Null
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "video_core/renderer_null/null_staging_buffer_pool.h"
+
+namespace Null {
+
+StagingBufferPool::StagingBufferPool() = default;
+
+StagingBufferPool::~StagingBufferPool() = default;
+
+StagingBufferMap StagingBufferPool::Request(size_t size) {
+    // Allocations only referenced by the pool are not in use by any map
+    auto it = std::ranges::find_if(allocations, [size](const auto& allocation) {
+        return allocation.use_count() == 1 && allocation->size() >= size;
+    });
+    if (it == allocations.end()) {
+        allocations.push_back(std::make_shared<std::vector<u8>>(size));
+        it = std::prev(allocations.end());
+    }
+    const std::span<u8> buffer{**it};
+    return StagingBufferMap{
+        .mapped_span = buffer.first(size),
+        .offset = 0,
+        .buffer = buffer,
+        .storage = *it,
+    };
+}
+
+void StagingBufferPool::Free(StagingBufferMap& map) {
+    map.storage.reset();
+}
+
+} // namespace Null
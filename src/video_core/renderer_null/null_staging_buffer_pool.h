@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Null {
+
+/// Host memory standing in for a mapped staging buffer
+struct StagingBufferMap {
+    std::span<u8> mapped_span;
+    size_t offset = 0;
+    std::span<u8> buffer;
+    std::shared_ptr<std::vector<u8>> storage;
+};
+
+/// Hands out reusable host allocations as staging buffers. An allocation is free again once no
+/// map refers to it anymore.
+class StagingBufferPool {
+public:
+    explicit StagingBufferPool();
+    ~StagingBufferPool();
+
+    [[nodiscard]] StagingBufferMap Request(size_t size);
+
+    void Free(StagingBufferMap& map);
+
+private:
+    std::vector<std::shared_ptr<std::vector<u8>>> allocations;
+};
+
+} // namespace Null
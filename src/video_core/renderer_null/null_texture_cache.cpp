@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "video_core/renderer_null/null_texture_cache.h"
+
+namespace Null {
+
+TextureCacheRuntime::TextureCacheRuntime(StagingBufferPool& staging_buffer_pool_)
+    : staging_buffer_pool{staging_buffer_pool_} {}
+
+TextureCacheRuntime::~TextureCacheRuntime() = default;
+
+StagingBufferMap TextureCacheRuntime::UploadStagingBuffer(size_t size) {
+    return staging_buffer_pool.Request(size);
+}
+
+StagingBufferMap TextureCacheRuntime::DownloadStagingBuffer(size_t size, bool deferred) {
+    return staging_buffer_pool.Request(size);
+}
+
+void TextureCacheRuntime::FreeDeferredStagingBuffer(StagingBufferMap& buffer) {
+    staging_buffer_pool.Free(buffer);
+}
+
+Image::Image(TextureCacheRuntime&, const VideoCommon::ImageInfo& info_, GPUVAddr gpu_addr_,
+             VAddr cpu_addr_)
+    : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), storage(unswizzled_size_bytes) {}
+
+Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBase{params} {}
+
+Image::~Image() = default;
+
+void Image::UploadMemory(const StagingBufferMap& map,
+                         std::span<const VideoCommon::BufferImageCopy> copies) {
+    // Copies are laid out like the unswizzled image, store them at the same offsets
+    for (const VideoCommon::BufferImageCopy& copy : copies) {
+        if (copy.buffer_offset >= storage.size() ||
+            map.offset + copy.buffer_offset >= map.buffer.size()) {
+            continue;
+        }
+        const size_t size = std::min({copy.buffer_size, storage.size() - copy.buffer_offset,
+                                      map.buffer.size() - map.offset - copy.buffer_offset});
+        std::memcpy(storage.data() + copy.buffer_offset,
+                    map.buffer.data() + map.offset + copy.buffer_offset, size);
+    }
+}
+
+void Image::DownloadMemory(std::span<std::span<u8>> buffers, std::span<size_t> buffer_offsets,
+                           std::span<const VideoCommon::BufferImageCopy> copies) {
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        const std::span<u8> buffer = buffers[i];
+        const size_t buffer_offset = buffer_offsets[i];
+        for (const VideoCommon::BufferImageCopy& copy : copies) {
+            if (copy.buffer_offset >= storage.size() ||
+                buffer_offset + copy.buffer_offset >= buffer.size()) {
+                continue;
+            }
+            const size_t size = std::min({copy.buffer_size, storage.size() - copy.buffer_offset,
+                                          buffer.size() - buffer_offset - copy.buffer_offset});
+            std::memcpy(buffer.data() + buffer_offset + copy.buffer_offset,
+                        storage.data() + copy.buffer_offset, size);
+        }
+    }
+}
+
+void Image::DownloadMemory(std::span<u8> buffer, size_t buffer_offset,
+                           std::span<const VideoCommon::BufferImageCopy> copies) {
+    std::array buffers{buffer};
+    std::array buffer_offsets{buffer_offset};
+    DownloadMemory(buffers, buffer_offsets, copies);
+}
+
+void Image::DownloadMemory(const StagingBufferMap& map,
+                           std::span<const VideoCommon::BufferImageCopy> copies) {
+    DownloadMemory(map.buffer, map.offset, copies);
+}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageViewInfo& info,
+                     ImageId image_id_, Image& image, const SlotVector<Image>&)
+    : VideoCommon::ImageViewBase{info, image.info, image_id_, image.gpu_addr} {}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
+                     const VideoCommon::ImageViewInfo& view_info, GPUVAddr gpu_addr_)
+    : VideoCommon::ImageViewBase{info, view_info, gpu_addr_} {}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
+                     const VideoCommon::ImageViewInfo& view_info)
+    : VideoCommon::ImageViewBase{info, view_info, 0} {}
+
+ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::NullImageViewParams& params)
+    : VideoCommon::ImageViewBase{params} {}
+
+} // namespace Null
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/engines/fermi_2d.h"
+#include "video_core/renderer_null/null_staging_buffer_pool.h"
+#include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/texture_cache_base.h"
+
+namespace Null {
+
+class Framebuffer;
+class Image;
+class ImageView;
+class Sampler;
+
+using Common::SlotVector;
+using VideoCommon::ImageId;
+using VideoCommon::NUM_RT;
+using VideoCommon::Region2D;
+using VideoCommon::RenderTargets;
+
+class TextureCacheRuntime {
+public:
+    explicit TextureCacheRuntime(StagingBufferPool& staging_buffer_pool);
+    ~TextureCacheRuntime();
+
+    void Finish() {}
+
+    StagingBufferMap UploadStagingBuffer(size_t size);
+
+    StagingBufferMap DownloadStagingBuffer(size_t size, bool deferred = false);
+
+    void FreeDeferredStagingBuffer(StagingBufferMap& buffer);
+
+    u64 GetDeviceLocalMemory() const {
+        return 0;
+    }
+
+    u64 GetDeviceMemoryUsage() const {
+        return 0;
+    }
+
+    bool CanReportMemoryUsage() const {
+        return false;
+    }
+
+    bool ShouldReinterpret(Image&, Image&) const noexcept {
+        return false;
+    }
+
+    bool CanUploadMSAA() const noexcept {
+        return true;
+    }
+
+    // Image to image copies and blits are not simulated, the destination keeps its old contents
+
+    void CopyImage(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void CopyImageMSAA(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void ReinterpretImage(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void ConvertImage(Framebuffer*, ImageView&, ImageView&) {}
+
+    bool CanImageBeCopied(const Image&, const Image&) {
+        return true;
+    }
+
+    void EmulateCopyImage(Image&, Image&, std::span<const VideoCommon::ImageCopy>) {}
+
+    void BlitFramebuffer(Framebuffer*, Framebuffer*, const Region2D&, const Region2D&,
+                         Tegra::Engines::Fermi2D::Filter, Tegra::Engines::Fermi2D::Operation) {}
+
+    void BlitImage(Framebuffer*, ImageView&, ImageView&, const Region2D&, const Region2D&,
+                   Tegra::Engines::Fermi2D::Filter, Tegra::Engines::Fermi2D::Operation) {}
+
+    void AccelerateImageUpload(Image&, const StagingBufferMap&,
+                               std::span<const VideoCommon::SwizzleParameters>) {}
+
+    void InsertUploadMemoryBarrier() {}
+
+    void TransitionImageLayout(Image&) {}
+
+    bool HasNativeBgr() const noexcept {
+        return true;
+    }
+
+    bool HasBrokenTextureViewFormats() const noexcept {
+        return false;
+    }
+
+    void TickFrame() {}
+
+    void BarrierFeedbackLoop() const noexcept {}
+
+private:
+    StagingBufferPool& staging_buffer_pool;
+};
+
+/// Image backed by host memory in its unswizzled layout, so downloads return what was uploaded
+class Image : public VideoCommon::ImageBase {
+public:
+    explicit Image(TextureCacheRuntime&, const VideoCommon::ImageInfo& info, GPUVAddr gpu_addr,
+                   VAddr cpu_addr);
+    explicit Image(const VideoCommon::NullImageParams&);
+
+    ~Image();
+
+    Image(const Image&) = delete;
+    Image& operator=(const Image&) = delete;
+
+    Image(Image&&) = default;
+    Image& operator=(Image&&) = default;
+
+    void UploadMemory(const StagingBufferMap& map,
+                      std::span<const VideoCommon::BufferImageCopy> copies);
+
+    void DownloadMemory(std::span<std::span<u8>> buffers, std::span<size_t> buffer_offsets,
+                        std::span<const VideoCommon::BufferImageCopy> copies);
+
+    void DownloadMemory(std::span<u8> buffer, size_t buffer_offset,
+                        std::span<const VideoCommon::BufferImageCopy> copies);
+
+    void DownloadMemory(const StagingBufferMap& map,
+                        std::span<const VideoCommon::BufferImageCopy> copies);
+
+    bool IsRescaled() const noexcept {
+        return false;
+    }
+
+    bool ScaleUp(bool ignore = false) {
+        return false;
+    }
+
+    bool ScaleDown(bool ignore = false) {
+        return false;
+    }
+
+private:
+    std::vector<u8> storage;
+};
+
+class ImageView : public VideoCommon::ImageViewBase {
+public:
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::ImageViewInfo&, ImageId, Image&,
+                       const SlotVector<Image>&);
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo&,
+                       const VideoCommon::ImageViewInfo&, GPUVAddr);
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
+                       const VideoCommon::ImageViewInfo& view_info);
+    explicit ImageView(TextureCacheRuntime&, const VideoCommon::NullImageViewParams&);
+};
+
+class ImageAlloc : public VideoCommon::ImageAllocBase {};
+
+class Sampler {
+public:
+    explicit Sampler(TextureCacheRuntime&, const Tegra::Texture::TSCEntry&) {}
+};
+
+class Framebuffer {
+public:
+    explicit Framebuffer(TextureCacheRuntime&, std::span<ImageView*, NUM_RT>, ImageView*,
+                         const VideoCommon::RenderTargets&) {}
+};
+
+struct TextureCacheParams {
+    static constexpr bool ENABLE_VALIDATION = true;
+    static constexpr bool FRAMEBUFFER_BLITS = false;
+    static constexpr bool HAS_EMULATED_COPIES = false;
+    static constexpr bool HAS_DEVICE_MEMORY_INFO = false;
+    static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+
+    using Runtime = Null::TextureCacheRuntime;
+    using Image = Null::Image;
+    using ImageAlloc = Null::ImageAlloc;
+    using ImageView = Null::ImageView;
+    using Sampler = Null::Sampler;
+    using Framebuffer = Null::Framebuffer;
+    using AsyncBuffer = Null::StagingBufferMap;
+    using BufferType = std::span<u8>;
+};
+
+using TextureCache = VideoCommon::TextureCache<TextureCacheParams>;
+
+} // namespace Null
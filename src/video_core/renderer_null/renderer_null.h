@@ -6,14 +6,16 @@
 #include <memory>
 #include <string>
 
+#include "video_core/host1x/gpu_device_memory_manager.h"
+#include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_base.h"
-#include "video_core/renderer_null/null_rasterizer.h"
 
 namespace Null {
 
 class RendererNull final : public VideoCore::RendererBase {
 public:
-    explicit RendererNull(Core::Frontend::EmuWindow& emu_window, Tegra::GPU& gpu,
+    explicit RendererNull(Core::Frontend::EmuWindow& emu_window,
+                          Tegra::MaxwellDeviceMemoryManager& device_memory, Tegra::GPU& gpu,
                           std::unique_ptr<Core::Frontend::GraphicsContext> context);
     ~RendererNull() override;
 
@@ -22,7 +24,7 @@ public:
     std::vector<u8> GetAppletCaptureBuffer() override;
 
     VideoCore::RasterizerInterface* ReadRasterizer() override {
-        return &m_rasterizer;
+        return m_rasterizer.get();
     }
 
     [[nodiscard]] std::string GetDeviceVendor() const override {
@@ -31,7 +33,7 @@ public:
 
 private:
     Tegra::GPU& m_gpu;
-    RasterizerNull m_rasterizer;
+    std::unique_ptr<VideoCore::RasterizerInterface> m_rasterizer;
 };
 
 } // namespace Null
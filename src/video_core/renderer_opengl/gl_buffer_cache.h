@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <span>
 #include <unordered_map>
 
@@ -150,12 +151,26 @@ public:
     }
 
     std::span<u8> BindMappedUniformBuffer(size_t stage, u32 binding_index, u32 size) noexcept {
-        const auto [mapped_span, offset] = stream_buffer->Request(static_cast<size_t>(size));
+        const StagingBufferMap map = staging_buffer_pool.RequestUploadBuffer(size);
         const GLuint base_binding = graphics_base_uniform_bindings[stage];
         const GLuint binding = base_binding + binding_index;
-        glBindBufferRange(GL_UNIFORM_BUFFER, binding, stream_buffer->Handle(),
-                          static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
-        return mapped_span;
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, map.buffer,
+                          static_cast<GLintptr>(map.offset), static_cast<GLsizeiptr>(size));
+        return map.mapped_span;
+    }
+
+    /// Uploads bindless texture handles to the given uniform buffer binding, each handle is
+    /// stored in a 16 byte slot to match the block declared by the shader
+    void BindBindlessTextures(GLuint binding, std::span<const GLuint64> handles) {
+        static constexpr size_t HANDLE_STRIDE = 16;
+        const size_t size = handles.size() * HANDLE_STRIDE;
+        const StagingBufferMap map = staging_buffer_pool.RequestUploadBuffer(size);
+        for (size_t index = 0; index < handles.size(); ++index) {
+            std::memcpy(map.mapped_span.data() + index * HANDLE_STRIDE, &handles[index],
+                        sizeof(GLuint64));
+        }
+        glBindBufferRange(GL_UNIFORM_BUFFER, binding, map.buffer,
+                          static_cast<GLintptr>(map.offset), static_cast<GLsizeiptr>(size));
     }
 
     [[nodiscard]] const GLvoid* IndexOffset() const noexcept {
@@ -222,8 +237,6 @@ private:
     GLuint* texture_handles = nullptr;
     GLuint* image_handles = nullptr;
 
-    std::optional<StreamBuffer> stream_buffer;
-
     std::array<std::array<OGLBuffer, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
                VideoCommon::NUM_STAGES>
         fast_uniforms;
@@ -251,9 +264,8 @@ struct BufferCacheParams {
     static constexpr bool NEEDS_BIND_STORAGE_INDEX = true;
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = true;
-
-    // TODO: Investigate why OpenGL seems to perform worse with persistently mapped buffer uploads
-    static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = false;
+    static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool CAN_IMPORT_HOST_MEMORY = false;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -237,6 +237,19 @@ Device::Device(Core::Frontend::EmuWindow& emu_window) {
     }
     has_lmem_perf_bug = is_nvidia;
 
+    // Bindless texture blocks take the last uniform buffer bindings, one per stage
+    use_bindless_textures = Settings::values.use_gl_bindless_textures.GetValue() &&
+                            GLAD_GL_ARB_bindless_texture &&
+                            shader_backend == Settings::ShaderBackend::Glsl;
+    bindless_texture_binding =
+        GetInteger<u32>(GL_MAX_UNIFORM_BUFFER_BINDINGS) - Shader::MaxStageTypes;
+    if (use_bindless_textures) {
+        // Each stage spends one of its uniform blocks on its bindless texture handles
+        for (u32& max_blocks : max_uniform_buffers) {
+            --max_blocks;
+        }
+    }
+
     strict_context_required = emu_window.StrictContextRequired();
     // Blocks Intel OpenGL drivers on Windows from using asynchronous shader compilation.
     // Blocks EGL on Wayland from using asynchronous shader compilation.
@@ -251,6 +264,7 @@ Device::Device(Core::Frontend::EmuWindow& emu_window) {
     LOG_INFO(Render_OpenGL, "Renderer_PreciseBug: {}", has_precise_bug);
     LOG_INFO(Render_OpenGL, "Renderer_BrokenTextureViewFormats: {}",
              has_broken_texture_view_formats);
+    LOG_INFO(Render_OpenGL, "Renderer_BindlessTextures: {}", use_bindless_textures);
     if (Settings::values.use_asynchronous_shaders.GetValue() && !use_asynchronous_shaders) {
         LOG_WARNING(Render_OpenGL, "Asynchronous shader compilation enabled but not supported");
     }
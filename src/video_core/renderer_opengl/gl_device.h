@@ -196,6 +196,14 @@ public:
         return has_lmem_perf_bug;
     }
 
+    bool UseBindlessTextures() const {
+        return use_bindless_textures;
+    }
+
+    u32 GetBindlessTextureBinding() const {
+        return bindless_texture_binding;
+    }
+
 private:
     static bool TestVariableAoffi();
     static bool TestPreciseBug();
@@ -207,6 +215,7 @@ private:
     u32 max_varyings{};
     u32 max_compute_shared_memory_size{};
     u32 max_glasm_storage_buffer_blocks{};
+    u32 bindless_texture_binding{};
 
     Settings::ShaderBackend shader_backend{};
 
@@ -243,6 +252,7 @@ private:
     bool strict_context_required{};
     bool supports_conditional_barriers{};
     bool has_lmem_perf_bug{};
+    bool use_bindless_textures{};
 
     std::string vendor_name;
 };
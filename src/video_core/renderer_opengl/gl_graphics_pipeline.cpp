@@ -225,6 +225,15 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
     use_storage_buffers =
         !assembly_shaders || num_storage_buffers <= device.GetMaxGLASMStorageBufferBlocks();
     writes_global_memory &= !use_storage_buffers;
+    use_bindless_textures = device.UseBindlessTextures();
+    bindless_texture_binding = device.GetBindlessTextureBinding();
+    if (use_bindless_textures) {
+        // Uniform buffers must not overlap the bindless texture blocks after them
+        const u32 num_uniform_bindings{
+            base_uniform_bindings.back() +
+            NumDescriptors(stage_infos.back().constant_buffer_descriptors)};
+        ASSERT(num_uniform_bindings <= bindless_texture_binding);
+    }
     configure_func = ConfigureFunc(stage_infos, enabled_stages_mask);
 
     if (key.xfb_enabled && device.UseAssemblyShaders()) {
@@ -453,6 +462,7 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
     std::array<GLuint, MAX_TEXTURES> textures;
     std::array<GLuint, MAX_IMAGES> images;
     std::array<GLuint, MAX_TEXTURES> gl_samplers;
+    std::array<GLuint64, MAX_TEXTURES> bindless_handles;
     const auto prepare_stage{[&](size_t stage) {
         buffer_cache.runtime.SetImagePointers(&textures[texture_binding], &images[image_binding]);
         buffer_cache.BindHostStageBuffers(stage);
@@ -476,23 +486,34 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
                 }
             }
         }
+        u32 num_bindless_handles{};
         for (const auto& desc : info.texture_descriptors) {
             for (u32 index = 0; index < desc.count; ++index) {
                 ImageView& image_view{texture_cache.GetImageView((views_it++)->id)};
-                textures[texture_binding] = image_view.Handle(desc.type);
                 if (texture_cache.IsRescaling(image_view)) {
                     texture_scaling_mask |= 1u << stage_texture_binding;
                 }
-                ++texture_binding;
                 ++stage_texture_binding;
 
                 const Sampler& sampler{texture_cache.GetSampler(*(samplers_it++))};
                 const bool use_fallback_sampler{sampler.HasAddedAnisotropy() &&
                                                 !image_view.SupportsAnisotropy()};
-                gl_samplers[sampler_binding++] =
-                    use_fallback_sampler ? sampler.HandleWithDefaultAnisotropy() : sampler.Handle();
+                const GLuint gl_sampler{use_fallback_sampler ? sampler.HandleWithDefaultAnisotropy()
+                                                             : sampler.Handle()};
+                if (use_bindless_textures) {
+                    bindless_handles[num_bindless_handles++] =
+                        image_view.BindlessHandle(desc.type, gl_sampler);
+                    continue;
+                }
+                textures[texture_binding++] = image_view.Handle(desc.type);
+                gl_samplers[sampler_binding++] = gl_sampler;
             }
         }
+        if (num_bindless_handles > 0) {
+            buffer_cache.runtime.BindBindlessTextures(
+                bindless_texture_binding + static_cast<GLuint>(stage),
+                std::span(bindless_handles.data(), num_bindless_handles));
+        }
         for (const auto& desc : info.image_descriptors) {
             for (u32 index = 0; index < desc.count; ++index) {
                 ImageView& image_view{texture_cache.GetImageView((views_it++)->id)};
@@ -147,8 +147,10 @@ private:
     std::array<u32, 5> base_storage_bindings{};
     std::array<u32, 5> num_texture_buffers{};
     std::array<u32, 5> num_image_buffers{};
+    u32 bindless_texture_binding{};
 
     bool use_storage_buffers{};
+    bool use_bindless_textures{};
     bool writes_global_memory{};
     bool uses_local_memory{};
 
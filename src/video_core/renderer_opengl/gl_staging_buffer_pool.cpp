@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <span>
@@ -14,6 +15,7 @@
 #include "video_core/renderer_opengl/gl_staging_buffer_pool.h"
 
 MICROPROFILE_DEFINE(OpenGL_BufferRequest, "OpenGL", "BufferRequest", MP_RGB(128, 128, 192));
+MICROPROFILE_DEFINE(OpenGL_StagingRingStall, "OpenGL", "Staging ring stall", MP_RGB(192, 64, 64));
 
 namespace OpenGL {
 
@@ -98,58 +100,97 @@ std::optional<size_t> StagingBuffers::FindBuffer(size_t requested_size) {
     return found;
 }
 
-StreamBuffer::StreamBuffer() {
-    static constexpr GLenum flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+StagingRing::StagingRing(size_t size, GLbitfield access_flags, GLbitfield storage_flags,
+                         std::string_view name_)
+    : ring_size{size}, region_size{size / NUM_SYNCS}, name{name_} {
+    ASSERT(ring_size % NUM_SYNCS == 0);
+    ASSERT(region_size % ALIGNMENT == 0);
+    const GLbitfield flags = access_flags | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
     buffer.Create();
-    glObjectLabel(GL_BUFFER, buffer.handle, -1, "Stream Buffer");
-    glNamedBufferStorage(buffer.handle, STREAM_BUFFER_SIZE, nullptr, flags);
-    mapped_pointer =
-        static_cast<u8*>(glMapNamedBufferRange(buffer.handle, 0, STREAM_BUFFER_SIZE, flags));
-    for (OGLSync& sync : fences) {
-        sync.Create();
-    }
+    glObjectLabel(GL_BUFFER, buffer.handle, static_cast<GLsizei>(name.size()), name.data());
+    glNamedBufferStorage(buffer.handle, static_cast<GLsizeiptr>(ring_size), nullptr,
+                         flags | storage_flags);
+    mapped_pointer = static_cast<u8*>(
+        glMapNamedBufferRange(buffer.handle, 0, static_cast<GLsizeiptr>(ring_size), flags));
 }
 
-std::pair<std::span<u8>, size_t> StreamBuffer::Request(size_t size) noexcept {
-    ASSERT(size < REGION_SIZE);
-    for (size_t region = Region(used_iterator), region_end = Region(iterator); region < region_end;
-         ++region) {
-        fences[region].Create();
+StagingRing::~StagingRing() = default;
+
+std::optional<StagingBufferMap> StagingRing::Request(size_t size) {
+    // Larger requests would have to wait for most of the ring, let them use dedicated buffers
+    if (size > region_size) {
+        return std::nullopt;
     }
-    used_iterator = iterator;
+    const size_t aligned_size = Common::AlignUp(size, ALIGNMENT);
 
-    for (size_t region = Region(free_iterator) + 1,
-                region_end = std::min(Region(iterator + size) + 1, NUM_SYNCS);
-         region < region_end; ++region) {
-        glClientWaitSync(fences[region].handle, 0, GL_TIMEOUT_IGNORED);
-        fences[region].Release();
+    // Commands using previous requests have been recorded by now, fence the regions they fill
+    FenceRegions(Region(iterator));
+    if (iterator + aligned_size > ring_size) {
+        // Wrap around, every region has to be claimed again
+        FenceRegions(NUM_SYNCS);
+        iterator = 0;
+        used_iterator = 0;
+        free_iterator = 0;
     }
-    if (iterator + size >= free_iterator) {
-        free_iterator = iterator + size;
+    const size_t end = iterator + aligned_size;
+    if (end > free_iterator) {
+        const size_t end_region = Region(end - 1) + 1;
+        ClaimRegions(Region(free_iterator), end_region);
+        free_iterator = end_region * region_size;
     }
-    if (iterator + size > STREAM_BUFFER_SIZE) {
-        for (size_t region = Region(used_iterator); region < NUM_SYNCS; ++region) {
-            fences[region].Create();
-        }
-        used_iterator = 0;
-        iterator = 0;
-        free_iterator = size;
+    const size_t offset = iterator;
+    iterator = end;
+    return StagingBufferMap{
+        .mapped_span = std::span(mapped_pointer + offset, size),
+        .offset = offset,
+        .sync = nullptr,
+        .buffer = buffer.handle,
+        .index = 0,
+    };
+}
 
-        for (size_t region = 0, region_end = Region(size); region <= region_end; ++region) {
-            glClientWaitSync(fences[region].handle, 0, GL_TIMEOUT_IGNORED);
-            fences[region].Release();
+void StagingRing::FenceRegions(size_t end_region) {
+    for (size_t region = Region(used_iterator); region < end_region; ++region) {
+        fences[region].Create();
+    }
+    used_iterator = std::max(used_iterator, end_region * region_size);
+}
+
+void StagingRing::ClaimRegions(size_t begin_region, size_t end_region) {
+    for (size_t region = begin_region; region < end_region; ++region) {
+        OGLSync& fence = fences[region];
+        if (fence.handle == 0) {
+            continue;
+        }
+        if (!fence.IsSignaled()) {
+            MICROPROFILE_SCOPE(OpenGL_StagingRingStall);
+            glClientWaitSync(fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
         }
+        fence.Release();
     }
-    const size_t offset = iterator;
-    iterator = Common::AlignUp(iterator + size, MAX_ALIGNMENT);
-    return {std::span(mapped_pointer + offset, size), offset};
 }
 
+StagingBufferPool::StagingBufferPool()
+    : upload_ring(UPLOAD_RING_SIZE, GL_MAP_WRITE_BIT, 0, "Upload Staging Ring"),
+      download_ring(DOWNLOAD_RING_SIZE, GL_MAP_READ_BIT, GL_CLIENT_STORAGE_BIT,
+                    "Download Staging Ring") {}
+
+StagingBufferPool::~StagingBufferPool() = default;
+
 StagingBufferMap StagingBufferPool::RequestUploadBuffer(size_t size) {
+    if (std::optional<StagingBufferMap> map = upload_ring.Request(size)) {
+        return *map;
+    }
     return upload_buffers.RequestMap(size, true);
 }
 
 StagingBufferMap StagingBufferPool::RequestDownloadBuffer(size_t size, bool deferred) {
+    // Deferred downloads are read long after their commands, they can't live in the ring
+    if (!deferred) {
+        if (std::optional<StagingBufferMap> map = download_ring.Request(size)) {
+            return *map;
+        }
+    }
     return download_buffers.RequestMap(size, false, deferred);
 }
 
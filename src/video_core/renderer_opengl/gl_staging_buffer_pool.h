@@ -6,7 +6,7 @@
 #include <array>
 #include <optional>
 #include <span>
-#include <utility>
+#include <string_view>
 #include <vector>
 
 #include <glad/glad.h>
@@ -55,48 +55,64 @@ struct StagingBuffers {
     size_t current_sync_index = 0;
 };
 
-class StreamBuffer {
-    static constexpr size_t STREAM_BUFFER_SIZE = 64_MiB;
+/// Large persistently mapped and coherent buffer used as a ring. Memory is reclaimed per region
+/// with fences inserted once the commands using a region have been recorded.
+class StagingRing {
     static constexpr size_t NUM_SYNCS = 16;
-    static constexpr size_t REGION_SIZE = STREAM_BUFFER_SIZE / NUM_SYNCS;
-    static constexpr size_t MAX_ALIGNMENT = 256;
-    static_assert(STREAM_BUFFER_SIZE % MAX_ALIGNMENT == 0);
-    static_assert(STREAM_BUFFER_SIZE % NUM_SYNCS == 0);
-    static_assert(REGION_SIZE % MAX_ALIGNMENT == 0);
+    static constexpr size_t ALIGNMENT = 256;
 
 public:
-    explicit StreamBuffer();
+    explicit StagingRing(size_t size, GLbitfield access_flags, GLbitfield storage_flags,
+                         std::string_view name);
+    ~StagingRing();
 
-    [[nodiscard]] std::pair<std::span<u8>, size_t> Request(size_t size) noexcept;
+    /// Returns a map of the requested size, or nullopt when the request is too large for the ring.
+    /// Waits for the GPU when the ring is exhausted.
+    [[nodiscard]] std::optional<StagingBufferMap> Request(size_t size);
 
     [[nodiscard]] GLuint Handle() const noexcept {
         return buffer.handle;
     }
 
 private:
-    [[nodiscard]] static size_t Region(size_t offset) noexcept {
-        return offset / REGION_SIZE;
+    [[nodiscard]] size_t Region(size_t offset) const noexcept {
+        return offset / region_size;
     }
 
+    /// Inserts fences for the regions used by requests whose commands have been recorded
+    void FenceRegions(size_t end_region);
+
+    /// Waits for the GPU to release the given range of regions
+    void ClaimRegions(size_t begin_region, size_t end_region);
+
+    size_t ring_size = 0;
+    size_t region_size = 0;
     size_t iterator = 0;
     size_t used_iterator = 0;
     size_t free_iterator = 0;
     u8* mapped_pointer = nullptr;
     OGLBuffer buffer;
     std::array<OGLSync, NUM_SYNCS> fences;
+    std::string_view name;
 };
 
 class StagingBufferPool {
+    static constexpr size_t UPLOAD_RING_SIZE = 256_MiB;
+    static constexpr size_t DOWNLOAD_RING_SIZE = 64_MiB;
+
 public:
-    StagingBufferPool() = default;
-    ~StagingBufferPool() = default;
+    StagingBufferPool();
+    ~StagingBufferPool();
 
     StagingBufferMap RequestUploadBuffer(size_t size);
     StagingBufferMap RequestDownloadBuffer(size_t size, bool deferred = false);
     void FreeDeferredStagingBuffer(StagingBufferMap& buffer);
 
 private:
-    StagingBuffers upload_buffers{GL_MAP_WRITE_BIT, GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT};
+    StagingRing upload_ring;
+    StagingRing download_ring;
+    StagingBuffers upload_buffers{GL_MAP_WRITE_BIT | GL_MAP_COHERENT_BIT,
+                                  GL_MAP_WRITE_BIT | GL_MAP_COHERENT_BIT};
     StagingBuffers download_buffers{GL_MAP_READ_BIT | GL_CLIENT_STORAGE_BIT, GL_MAP_READ_BIT};
 };
 
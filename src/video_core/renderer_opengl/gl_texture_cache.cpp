@@ -738,7 +738,6 @@ void Image::UploadMemory(GLuint buffer_handle, size_t buffer_offset,
         ScaleDown(true);
     }
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer_handle);
-    glFlushMappedBufferRange(GL_PIXEL_UNPACK_BUFFER, buffer_offset, unswizzled_size_bytes);
 
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
@@ -1207,7 +1206,36 @@ ImageView::ImageView(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
 ImageView::ImageView(TextureCacheRuntime& runtime, const VideoCommon::NullImageViewParams& params)
     : VideoCommon::ImageViewBase{params}, views{runtime.null_image_views} {}
 
-ImageView::~ImageView() = default;
+ImageView::~ImageView() {
+    for (const BindlessHandleEntry& entry : bindless_handles) {
+        // Null views are shared between image views, keep their handles resident
+        if (entry.is_owned) {
+            glMakeTextureHandleNonResidentARB(entry.handle);
+        }
+    }
+}
+
+GLuint64 ImageView::BindlessHandle(Shader::TextureType handle_type, GLuint sampler) {
+    const GLuint texture = Handle(handle_type);
+    for (const BindlessHandleEntry& entry : bindless_handles) {
+        if (entry.texture == texture && entry.sampler == sampler) {
+            return entry.handle;
+        }
+    }
+    const bool is_owned = std::ranges::any_of(
+        stored_views, [texture](const OGLTextureView& view) { return view.handle == texture; });
+    const GLuint64 handle = glGetTextureSamplerHandleARB(texture, sampler);
+    if (is_owned || !glIsTextureHandleResidentARB(handle)) {
+        glMakeTextureHandleResidentARB(handle);
+    }
+    bindless_handles.push_back({
+        .texture = texture,
+        .sampler = sampler,
+        .handle = handle,
+        .is_owned = is_owned,
+    });
+    return handle;
+}
 
 GLuint ImageView::StorageView(Shader::TextureType texture_type, Shader::ImageFormat image_format) {
     if (image_format == Shader::ImageFormat::Typeless) {
@@ -272,6 +272,9 @@ public:
         return default_handle;
     }
 
+    /// Returns a resident bindless handle of the view of the given type sampled with a sampler
+    [[nodiscard]] GLuint64 BindlessHandle(Shader::TextureType handle_type, GLuint sampler);
+
     [[nodiscard]] GLenum Format() const noexcept {
         return internal_format;
     }
@@ -290,6 +293,13 @@ private:
         std::array<GLuint, Shader::NUM_TEXTURE_TYPES> unsigneds{};
     };
 
+    struct BindlessHandleEntry {
+        GLuint texture;
+        GLuint sampler;
+        GLuint64 handle;
+        bool is_owned;
+    };
+
     void SetupView(Shader::TextureType view_type);
 
     GLuint MakeView(Shader::TextureType view_type, GLenum view_format);
@@ -297,6 +307,7 @@ private:
     std::array<GLuint, Shader::NUM_TEXTURE_TYPES> views{};
     std::vector<OGLTextureView> stored_views;
     std::unique_ptr<StorageViews> storage_views;
+    std::vector<BindlessHandleEntry> bindless_handles;
     GLenum internal_format = GL_NONE;
     GLuint default_handle = 0;
     u32 buffer_size = 0;
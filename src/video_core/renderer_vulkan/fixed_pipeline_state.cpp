@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
 
 #include "common/bit_cast.h"
 #include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/container_hash.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/engines/draw_manager.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -14,6 +16,16 @@
 
 namespace Vulkan {
 namespace {
+constexpr std::array<size_t, FixedPipelineState::NumHashGroups + 1> HASH_GROUP_OFFSETS{
+    0,
+    offsetof(FixedPipelineState, dynamic_state),
+    offsetof(FixedPipelineState, attachments),
+    offsetof(FixedPipelineState, attributes),
+    offsetof(FixedPipelineState, vertex_strides),
+    offsetof(FixedPipelineState, xfb_state),
+    sizeof(FixedPipelineState),
+};
+
 constexpr size_t POINT = 0;
 constexpr size_t LINE = 1;
 constexpr size_t POLYGON = 2;
@@ -48,9 +60,10 @@ void RefreshXfbState(VideoCommon::TransformFeedbackState& state, const Maxwell&
 }
 } // Anonymous namespace
 
-void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features) {
+u32 FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features) {
     const Maxwell& regs = maxwell3d.regs;
     const auto topology_ = maxwell3d.draw_manager->GetDrawState().topology;
+    u32 refreshed_groups = (1U << HashGroupHeader) | (1U << HashGroupDynamicState);
 
     raw1 = 0;
     extended_dynamic_state.Assign(features.has_extended_dynamic_state ? 1 : 0);
@@ -114,6 +127,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
             }
         } else {
             maxwell3d.dirty.flags[Dirty::VertexInput] = false;
+            refreshed_groups |= 1U << HashGroupAttributes;
             enabled_divisors = 0;
             for (size_t index = 0; index < Maxwell::NumVertexArrays; ++index) {
                 const bool is_enabled = regs.vertex_stream_instances.IsInstancingEnabled(index);
@@ -146,6 +160,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
         std::ranges::transform(regs.vertex_streams, vertex_strides.begin(), [](const auto& array) {
             return static_cast<u16>(array.stride.Value());
         });
+        refreshed_groups |= 1U << HashGroupVertexStrides;
     }
     if (!extended_dynamic_state_2_extra) {
         dynamic_state.Refresh2(regs, topology_, extended_dynamic_state_2);
@@ -153,6 +168,7 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     if (!extended_dynamic_state_3_blend) {
         if (maxwell3d.dirty.flags[Dirty::Blending]) {
             maxwell3d.dirty.flags[Dirty::Blending] = false;
+            refreshed_groups |= 1U << HashGroupAttachments;
             for (size_t index = 0; index < attachments.size(); ++index) {
                 attachments[index].Refresh(regs, index);
             }
@@ -163,7 +179,9 @@ void FixedPipelineState::Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFe
     }
     if (xfb_enabled) {
         RefreshXfbState(xfb_state, regs);
+        refreshed_groups |= 1U << HashGroupTransformFeedback;
     }
+    return refreshed_groups;
 }
 
 void FixedPipelineState::BlendingAttachment::Refresh(const Maxwell& regs, size_t index) {
@@ -261,8 +279,28 @@ void FixedPipelineState::DynamicState::Refresh3(const Maxwell& regs) {
 }
 
 size_t FixedPipelineState::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
-    return static_cast<size_t>(hash);
+    const size_t size = Size();
+    std::array<u64, NumHashGroups> group_hashes{};
+    for (size_t group = 0; group < NumHashGroups && HASH_GROUP_OFFSETS[group] < size; ++group) {
+        group_hashes[group] = GroupHash(static_cast<HashGroup>(group));
+    }
+    return Hash(group_hashes);
+}
+
+size_t FixedPipelineState::Hash(std::span<const u64, NumHashGroups> group_hashes) const noexcept {
+    // Only the groups that are part of Size() contribute to the hash
+    const size_t size = Size();
+    size_t hash = 0;
+    for (size_t group = 0; group < NumHashGroups && HASH_GROUP_OFFSETS[group] < size; ++group) {
+        Common::HashCombine(hash, group_hashes[group]);
+    }
+    return hash;
+}
+
+u64 FixedPipelineState::GroupHash(HashGroup group) const noexcept {
+    const size_t begin = HASH_GROUP_OFFSETS[group];
+    const size_t end = HASH_GROUP_OFFSETS[group + 1];
+    return Common::CityHash64(reinterpret_cast<const char*>(this) + begin, end - begin);
 }
 
 bool FixedPipelineState::operator==(const FixedPipelineState& rhs) const noexcept {
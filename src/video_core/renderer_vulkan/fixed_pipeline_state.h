@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <type_traits>
 
 #include "common/bit_field.h"
@@ -27,6 +28,17 @@ struct DynamicFeatures {
 };
 
 struct FixedPipelineState {
+    /// Ranges of the state that are hashed independently, so refreshes only rehash what they wrote
+    enum HashGroup : u32 {
+        HashGroupHeader,
+        HashGroupDynamicState,
+        HashGroupAttachments,
+        HashGroupAttributes,
+        HashGroupVertexStrides,
+        HashGroupTransformFeedback,
+        NumHashGroups,
+    };
+
     static u32 PackComparisonOp(Maxwell::ComparisonOp op) noexcept;
     static Maxwell::ComparisonOp UnpackComparisonOp(u32 packed) noexcept;
 
@@ -233,10 +245,17 @@ struct FixedPipelineState {
 
     VideoCommon::TransformFeedbackState xfb_state;
 
-    void Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features);
+    /// Refreshes the state from the registers, returns a mask of the hash groups rewritten
+    u32 Refresh(Tegra::Engines::Maxwell3D& maxwell3d, DynamicFeatures& features);
 
     size_t Hash() const noexcept;
 
+    /// Returns the hash of the state from the hashes of each of its groups
+    size_t Hash(std::span<const u64, NumHashGroups> group_hashes) const noexcept;
+
+    /// Returns the hash of a single group of the state, see HashGroup
+    u64 GroupHash(HashGroup group) const noexcept;
+
     bool operator==(const FixedPipelineState& rhs) const noexcept;
 
     bool operator!=(const FixedPipelineState& rhs) const noexcept {
@@ -114,7 +114,7 @@ RendererVulkan::RendererVulkan(Core::TelemetrySession& telemetry_session_,
       swapchain(*surface, device, scheduler, render_window.GetFramebufferLayout().width,
                 render_window.GetFramebufferLayout().height),
       present_manager(instance, render_window, device, memory_allocator, scheduler, swapchain,
-                      surface),
+                      surface, gpu),
       blit_swapchain(device_memory, device, memory_allocator, present_manager, scheduler,
                      PresentFiltersForDisplay),
       blit_capture(device_memory, device, memory_allocator, present_manager, scheduler,
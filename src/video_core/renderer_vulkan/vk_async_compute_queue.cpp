@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <span>
+
+#include "common/assert.h"
+#include "video_core/renderer_vulkan/vk_async_compute_queue.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+AsyncComputeQueue::AsyncComputeQueue(const Device& device_)
+    : device{device_}, family{device.GetComputeFamily()},
+      master_semaphore(device, device.GetComputeQueue()),
+      command_pool(master_semaphore, device, family) {
+    ASSERT(device.HasAsyncComputeQueue());
+}
+
+AsyncComputeQueue::~AsyncComputeQueue() = default;
+
+vk::CommandBuffer AsyncComputeQueue::Begin() {
+    if (is_recording) {
+        return current_cmdbuf;
+    }
+    current_cmdbuf = vk::CommandBuffer(command_pool.Commit(), device.GetDispatchLoader());
+    current_cmdbuf.Begin({
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        .pInheritanceInfo = nullptr,
+    });
+    is_recording = true;
+    return current_cmdbuf;
+}
+
+u64 AsyncComputeQueue::Submit() {
+    ASSERT(is_recording);
+    current_cmdbuf.End();
+    is_recording = false;
+
+    const u64 signal_value = master_semaphore.NextTick();
+    const VkCommandBuffer cmdbuf = *current_cmdbuf;
+    switch (const VkResult result = master_semaphore.SubmitQueue(std::span(&cmdbuf, 1), nullptr,
+                                                                 nullptr, signal_value)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+    return signal_value;
+}
+
+} // namespace Vulkan
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+
+/// Records and submits work to a dedicated compute queue family, so it can overlap rendering.
+/// Resources used by both queues have to be transferred between the queue families, and the
+/// graphics queue has to wait for the submitted ticks before consuming them.
+class AsyncComputeQueue {
+public:
+    explicit AsyncComputeQueue(const Device& device);
+    ~AsyncComputeQueue();
+
+    /// Returns a command buffer in the recording state, recorded work is sent on Submit.
+    [[nodiscard]] vk::CommandBuffer Begin();
+
+    /// Submits the recorded command buffer and returns the tick signalled on its completion.
+    u64 Submit();
+
+    /// Returns the timeline of the compute queue.
+    [[nodiscard]] const MasterSemaphore& GetMasterSemaphore() const noexcept {
+        return master_semaphore;
+    }
+
+    /// Returns the queue family index of the compute queue.
+    [[nodiscard]] u32 Family() const noexcept {
+        return family;
+    }
+
+private:
+    const Device& device;
+    u32 family;
+    MasterSemaphore master_semaphore;
+    CommandPool command_pool;
+    vk::CommandBuffer current_cmdbuf;
+    bool is_recording = false;
+};
+
+} // namespace Vulkan
@@ -9,6 +9,8 @@
 
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 
+#include "common/alignment.h"
+#include "video_core/host1x/gpu_device_memory_manager.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
@@ -51,7 +53,7 @@ size_t BytesPerIndex(VkIndexType index_type) {
     }
 }
 
-vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size) {
+VkBufferCreateInfo MakeBufferCreateInfo(const Device& device, u64 size) {
     VkBufferUsageFlags flags =
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
         VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
@@ -64,7 +66,7 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
     if (device.IsExtConditionalRendering()) {
         flags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
     }
-    const VkBufferCreateInfo buffer_ci = {
+    return VkBufferCreateInfo{
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -74,7 +76,11 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
     };
-    return memory_allocator.CreateBuffer(buffer_ci, MemoryUsage::DeviceLocal);
+}
+
+vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size) {
+    return memory_allocator.CreateBuffer(MakeBufferCreateInfo(device, size),
+                                         MemoryUsage::DeviceLocal);
 }
 } // Anonymous namespace
 
@@ -90,7 +96,14 @@ Buffer::Buffer(BufferCacheRuntime& runtime, VideoCommon::NullBufferParams null_p
 
 Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
     : VideoCommon::BufferBase(cpu_addr_, size_bytes_), device{&runtime.device},
-      buffer{CreateBuffer(*device, runtime.memory_allocator, SizeBytes())}, tracker{SizeBytes()} {
+      tracker{SizeBytes()} {
+    if (device->IsExtExternalMemoryHostSupported()) {
+        buffer = runtime.ImportGuestMemory(CpuAddr(), SizeBytes(), imported_memory,
+                                           imported_pointer);
+    }
+    if (!buffer) {
+        buffer = CreateBuffer(*device, runtime.memory_allocator, SizeBytes());
+    }
     if (runtime.device.HasDebuggingToolAttached()) {
         buffer.SetObjectNameEXT(fmt::format("Buffer 0x{:x}", CpuAddr()).c_str());
     }
@@ -324,9 +337,11 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                        Scheduler& scheduler_, StagingBufferPool& staging_pool_,
                                        GuestDescriptorQueue& guest_descriptor_queue_,
                                        ComputePassDescriptorQueue& compute_pass_descriptor_queue,
-                                       DescriptorPool& descriptor_pool)
+                                       DescriptorPool& descriptor_pool,
+                                       Tegra::MaxwellDeviceMemoryManager& device_memory_)
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
       staging_pool{staging_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
+      device_memory{device_memory_},
       quad_index_pass(device, scheduler, descriptor_pool, staging_pool,
                       compute_pass_descriptor_queue) {
     if (device.GetDriverID() != VK_DRIVER_ID_QUALCOMM_PROPRIETARY) {
@@ -340,6 +355,26 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
                                                                      scheduler_, staging_pool_);
 }
 
+vk::Buffer BufferCacheRuntime::ImportGuestMemory(DAddr device_addr, u64 size,
+                                                 vk::DeviceMemory& memory, u8*& host_pointer) {
+    // Only ranges backed by contiguous host memory can be imported as a single allocation
+    u8* const pointer = device_memory.GetSpan(device_addr, size);
+    if (!pointer) {
+        return {};
+    }
+    const VkDeviceSize alignment = device.GetMinImportedHostPointerAlignment();
+    if (!Common::IsAligned(reinterpret_cast<uintptr_t>(pointer), alignment) ||
+        !Common::IsAligned(size, alignment)) {
+        return {};
+    }
+    vk::Buffer buffer = memory_allocator.CreateImportedBuffer(MakeBufferCreateInfo(device, size),
+                                                              pointer, memory);
+    if (buffer) {
+        host_pointer = pointer;
+    }
+    return buffer;
+}
+
 StagingBufferRef BufferCacheRuntime::UploadStagingBuffer(size_t size) {
     return staging_pool.Request(size, MemoryUsage::Upload);
 }
@@ -46,6 +46,21 @@ public:
         tracker.Reset();
     }
 
+    /// Returns true when the buffer is backed by imported guest memory instead of its own copy
+    [[nodiscard]] bool IsHostMemoryImported() const noexcept {
+        return imported_pointer != nullptr;
+    }
+
+    /// Returns the host pointer of the guest memory imported when the buffer was created
+    [[nodiscard]] const u8* ImportedHostPointer() const noexcept {
+        return imported_pointer;
+    }
+
+    /// Stops treating the imported memory as guest memory, the buffer keeps a copy from now on
+    void DetachHostMemory() noexcept {
+        imported_pointer = nullptr;
+    }
+
     operator VkBuffer() const noexcept {
         return *buffer;
     }
@@ -59,6 +74,8 @@ private:
     };
 
     const Device* device{};
+    vk::DeviceMemory imported_memory;
+    u8* imported_pointer{};
     vk::Buffer buffer;
     std::vector<BufferView> views;
     VideoCommon::UsageTracker tracker;
@@ -79,7 +96,8 @@ public:
                                 Scheduler& scheduler_, StagingBufferPool& staging_pool_,
                                 GuestDescriptorQueue& guest_descriptor_queue,
                                 ComputePassDescriptorQueue& compute_pass_descriptor_queue,
-                                DescriptorPool& descriptor_pool);
+                                DescriptorPool& descriptor_pool,
+                                Tegra::MaxwellDeviceMemoryManager& device_memory);
 
     void TickFrame(Common::SlotVector<Buffer>& slot_buffers) noexcept;
 
@@ -153,11 +171,16 @@ private:
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
+    /// Creates a buffer aliasing guest memory, returns a null buffer if the range can't be imported
+    vk::Buffer ImportGuestMemory(DAddr device_addr, u64 size, vk::DeviceMemory& memory,
+                                 u8*& host_pointer);
+
     const Device& device;
     MemoryAllocator& memory_allocator;
     Scheduler& scheduler;
     StagingBufferPool& staging_pool;
     GuestDescriptorQueue& guest_descriptor_queue;
+    Tegra::MaxwellDeviceMemoryManager& device_memory;
 
     std::shared_ptr<QuadArrayIndexBuffer> quad_array_index_buffer;
     std::shared_ptr<QuadStripIndexBuffer> quad_strip_index_buffer;
@@ -182,6 +205,7 @@ struct BufferCacheParams {
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool CAN_IMPORT_HOST_MEMORY = true;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <vector>
 
+#include "common/common_types.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -17,6 +18,8 @@ class MasterSemaphore;
 class CommandPool final : public ResourcePool {
 public:
     explicit CommandPool(MasterSemaphore& master_semaphore_, const Device& device_);
+    explicit CommandPool(MasterSemaphore& master_semaphore_, const Device& device_,
+                         u32 queue_family_);
     ~CommandPool() override;
 
     void Allocate(size_t begin, size_t end) override;
@@ -27,6 +30,7 @@ private:
     struct Pool;
 
     const Device& device;
+    u32 queue_family;
     std::vector<Pool> pools;
 };
 
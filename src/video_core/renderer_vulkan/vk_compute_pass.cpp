@@ -21,6 +21,7 @@
 #include "video_core/host_shaders/resolve_conditional_render_comp_spv.h"
 #include "video_core/host_shaders/vulkan_quad_indexed_comp_spv.h"
 #include "video_core/host_shaders/vulkan_uint8_comp_spv.h"
+#include "video_core/renderer_vulkan/vk_async_compute_queue.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -218,6 +219,26 @@ struct AstcPushConstants {
     u32 block_height_mask;
 };
 
+AstcPushConstants MakeAstcPushConstants(const Image& image,
+                                        const VideoCommon::SwizzleParameters& swizzle) {
+    using namespace VideoCommon::Accelerated;
+    const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
+    ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
+    ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
+    ASSERT(params.bytes_per_block_log2 == 4);
+    return AstcPushConstants{
+        .blocks_dims{
+            VideoCore::Surface::DefaultBlockWidth(image.info.format),
+            VideoCore::Surface::DefaultBlockHeight(image.info.format),
+        },
+        .layer_stride = params.layer_stride,
+        .block_size = params.block_size,
+        .x_shift = params.x_shift,
+        .block_height = params.block_height,
+        .block_height_mask = params.block_height_mask,
+    };
+}
+
 struct QueriesPrefixScanPushConstants {
     u32 min_accumulation_base;
     u32 max_accumulation_base;
@@ -526,28 +547,35 @@ ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                                  DescriptorPool& descriptor_pool_,
                                  StagingBufferPool& staging_buffer_pool_,
                                  ComputePassDescriptorQueue& compute_pass_descriptor_queue_,
-                                 MemoryAllocator& memory_allocator_)
+                                 MemoryAllocator& memory_allocator_,
+                                 AsyncComputeQueue* async_compute_queue_)
     : ComputePass(device_, descriptor_pool_, ASTC_DESCRIPTOR_SET_BINDINGS,
                   ASTC_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, ASTC_BANK_INFO,
                   COMPUTE_PUSH_CONSTANT_RANGE<sizeof(AstcPushConstants)>, ASTC_DECODER_COMP_SPV),
       scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
-      compute_pass_descriptor_queue{compute_pass_descriptor_queue_}, memory_allocator{
-                                                                         memory_allocator_} {}
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_},
+      memory_allocator{memory_allocator_}, async_compute_queue{async_compute_queue_} {
+    if (async_compute_queue) {
+        async_descriptor_pool.emplace(device, scheduler);
+        async_descriptor_allocator =
+            async_descriptor_pool->Allocator(*descriptor_set_layout, ASTC_BANK_INFO);
+    }
+}
 
 ASTCDecoderPass::~ASTCDecoderPass() = default;
 
 void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
                                std::span<const VideoCommon::SwizzleParameters> swizzles) {
-    using namespace VideoCommon::Accelerated;
-    const std::array<u32, 2> block_dims{
-        VideoCore::Surface::DefaultBlockWidth(image.info.format),
-        VideoCore::Surface::DefaultBlockHeight(image.info.format),
-    };
+    const bool is_initialized = image.ExchangeInitialization();
+    if (async_compute_queue && !is_initialized) {
+        // Images without contents don't have to be transferred to the compute queue first
+        AssembleAsync(image, map, swizzles);
+        return;
+    }
     scheduler.RequestOutsideRenderPassOperationContext();
     const VkPipeline vk_pipeline = *pipeline;
     const VkImageAspectFlags aspect_mask = image.AspectMask();
     const VkImage vk_image = image.Handle();
-    const bool is_initialized = image.ExchangeInitialization();
     scheduler.Record([vk_pipeline, vk_image, aspect_mask,
                       is_initialized](vk::CommandBuffer cmdbuf) {
         const VkImageMemoryBarrier image_barrier{
@@ -587,20 +615,9 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
         // To unswizzle the ASTC data
-        const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
-        ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
-        ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
-        ASSERT(params.bytes_per_block_log2 == 4);
-        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, block_dims,
-                          params, descriptor_data](vk::CommandBuffer cmdbuf) {
-            const AstcPushConstants uniforms{
-                .blocks_dims = block_dims,
-                .layer_stride = params.layer_stride,
-                .block_size = params.block_size,
-                .x_shift = params.x_shift,
-                .block_height = params.block_height,
-                .block_height_mask = params.block_height_mask,
-            };
+        const AstcPushConstants uniforms = MakeAstcPushConstants(image, swizzle);
+        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, uniforms,
+                          descriptor_data](vk::CommandBuffer cmdbuf) {
             const VkDescriptorSet set = descriptor_allocator.Commit();
             device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
             cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
@@ -633,6 +650,86 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
     scheduler.Finish();
 }
 
+void ASTCDecoderPass::AssembleAsync(Image& image, const StagingBufferRef& map,
+                                    std::span<const VideoCommon::SwizzleParameters> swizzles) {
+    const VkImageSubresourceRange subresource_range{
+        .aspectMask = image.AspectMask(),
+        .baseMipLevel = 0,
+        .levelCount = VK_REMAINING_MIP_LEVELS,
+        .baseArrayLayer = 0,
+        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+    };
+    const u32 compute_family = async_compute_queue->Family();
+    const u32 graphics_family = device.GetGraphicsFamily();
+
+    // Descriptor sets and the staging buffer are owned by the current graphics tick, it waits
+    // for the decode to finish before it can be signalled. The staging buffer is shared with the
+    // compute queue family, only the image has to change ownership.
+    const VkImageMemoryBarrier init_barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_NONE,
+        .dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image.Handle(),
+        .subresourceRange = subresource_range,
+    };
+    const vk::CommandBuffer cmdbuf = async_compute_queue->Begin();
+    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                           0, init_barrier);
+    cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+    for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
+        // The sets are written right away, so the entries don't have to outlive this loop
+        std::array<DescriptorUpdateEntry, ASTC_NUM_BINDINGS> descriptor_data;
+        descriptor_data[ASTC_BINDING_INPUT_BUFFER] = VkDescriptorBufferInfo{
+            .buffer = map.buffer,
+            .offset = swizzle.buffer_offset + map.offset,
+            .range = image.guest_size_bytes - swizzle.buffer_offset,
+        };
+        descriptor_data[ASTC_BINDING_OUTPUT_IMAGE] = VkDescriptorImageInfo{
+            .sampler = VK_NULL_HANDLE,
+            .imageView = image.StorageImageView(swizzle.level),
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+        };
+        const VkDescriptorSet set = async_descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data.data());
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT,
+                             MakeAstcPushConstants(image, swizzle));
+        cmdbuf.Dispatch(Common::DivCeil(swizzle.num_tiles.width, 8U),
+                        Common::DivCeil(swizzle.num_tiles.height, 8U), image.info.resources.layers);
+    }
+    // Release the image to the graphics queue, a matching acquire is recorded there with the same
+    // stage masks
+    static constexpr VkPipelineStageFlags ownership_src = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    static constexpr VkPipelineStageFlags ownership_dst = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkImageMemoryBarrier ownership_barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_NONE,
+        .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .srcQueueFamilyIndex = compute_family,
+        .dstQueueFamilyIndex = graphics_family,
+        .image = image.Handle(),
+        .subresourceRange = subresource_range,
+    };
+    cmdbuf.PipelineBarrier(ownership_src, ownership_dst, 0, ownership_barrier);
+    const u64 decode_tick = async_compute_queue->Submit();
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.WaitOnSubmit(async_compute_queue->GetMasterSemaphore(), decode_tick);
+    ownership_barrier.srcAccessMask = VK_ACCESS_NONE;
+    ownership_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    scheduler.Record([ownership_barrier](vk::CommandBuffer graphics_cmdbuf) {
+        graphics_cmdbuf.PipelineBarrier(ownership_src, ownership_dst, 0, ownership_barrier);
+    });
+}
+
 MSAACopyPass::MSAACopyPass(const Device& device_, Scheduler& scheduler_,
                            DescriptorPool& descriptor_pool_,
                            StagingBufferPool& staging_buffer_pool_,
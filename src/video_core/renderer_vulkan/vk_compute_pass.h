@@ -21,6 +21,7 @@ struct SwizzleParameters;
 
 namespace Vulkan {
 
+class AsyncComputeQueue;
 class Device;
 class StagingBufferPool;
 class Scheduler;
@@ -118,17 +119,28 @@ public:
                              DescriptorPool& descriptor_pool_,
                              StagingBufferPool& staging_buffer_pool_,
                              ComputePassDescriptorQueue& compute_pass_descriptor_queue_,
-                             MemoryAllocator& memory_allocator_);
+                             MemoryAllocator& memory_allocator_,
+                             AsyncComputeQueue* async_compute_queue_ = nullptr);
     ~ASTCDecoderPass();
 
     void Assemble(Image& image, const StagingBufferRef& map,
                   std::span<const VideoCommon::SwizzleParameters> swizzles);
 
 private:
+    /// Decodes a newly created image on the async compute queue and hands it to the graphics queue
+    void AssembleAsync(Image& image, const StagingBufferRef& map,
+                       std::span<const VideoCommon::SwizzleParameters> swizzles);
+
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
     MemoryAllocator& memory_allocator;
+    AsyncComputeQueue* async_compute_queue;
+
+    /// Descriptor sets of the async path are committed on the GPU thread while the ones of the
+    /// synchronous path are committed on the scheduler worker, so they come from separate pools
+    std::optional<DescriptorPool> async_descriptor_pool;
+    DescriptorAllocator async_descriptor_allocator;
 };
 
 class MSAACopyPass final : public ComputePass {
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/literals.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+
+namespace Vulkan {
+namespace {
+
+using namespace Common::Literals;
+
+// Descriptor ring size in bytes, enough for several frames of draws with many descriptors
+constexpr VkDeviceSize MAX_RING_SIZE = 32_MiB;
+
+constexpr VkBufferUsageFlags RING_USAGE = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                                          VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                                          VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+size_t DescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& properties,
+                      VkDescriptorType type) {
+    // Robust buffer access is always enabled, buffer descriptors use their robust sizes
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return properties.robustUniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return properties.robustStorageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return properties.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return properties.storageImageDescriptorSize;
+    default:
+        UNREACHABLE_MSG("Invalid descriptor buffer type={}", static_cast<u32>(type));
+        return 0;
+    }
+}
+} // Anonymous namespace
+
+DescriptorBufferLayout::DescriptorBufferLayout(
+    const Device& device_, VkDescriptorSetLayout set_layout,
+    std::span<const VkDescriptorUpdateTemplateEntry> entries)
+    : device{&device_} {
+    const vk::Device& dev{device->GetLogical()};
+    const auto& properties{device->DescriptorBufferProperties()};
+    size = dev.GetDescriptorSetLayoutSizeEXT(set_layout);
+    for (const VkDescriptorUpdateTemplateEntry& entry : entries) {
+        bindings.push_back({
+            .type = entry.descriptorType,
+            .count = entry.descriptorCount,
+            .src_offset = entry.offset,
+            .dst_offset = dev.GetDescriptorSetLayoutBindingOffsetEXT(set_layout, entry.dstBinding),
+            .descriptor_size = DescriptorSize(properties, entry.descriptorType),
+        });
+    }
+}
+
+void DescriptorBufferLayout::Write(u8* dst, const DescriptorUpdateEntry* payload) const {
+    const vk::Device& dev{device->GetLogical()};
+    const u8* const src{reinterpret_cast<const u8*>(payload)};
+
+    // Consecutive buffer descriptors tend to point to the same buffer, avoid querying it again
+    VkBuffer last_buffer{};
+    VkDeviceAddress last_address{};
+    for (const Binding& binding : bindings) {
+        for (u32 index = 0; index < binding.count; ++index) {
+            const DescriptorUpdateEntry& entry{*reinterpret_cast<const DescriptorUpdateEntry*>(
+                src + binding.src_offset + index * sizeof(DescriptorUpdateEntry))};
+            VkDescriptorAddressInfoEXT address_info;
+            VkDescriptorGetInfoEXT get_info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = binding.type,
+                .data{},
+            };
+            switch (binding.type) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                if (entry.buffer.buffer != last_buffer) {
+                    last_buffer = entry.buffer.buffer;
+                    last_address = dev.GetBufferDeviceAddress(last_buffer);
+                }
+                address_info = {
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                    .pNext = nullptr,
+                    .address = last_address + entry.buffer.offset,
+                    .range = entry.buffer.range,
+                    .format = VK_FORMAT_UNDEFINED,
+                };
+                if (binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+                    get_info.data.pUniformBuffer = &address_info;
+                } else {
+                    get_info.data.pStorageBuffer = &address_info;
+                }
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                get_info.data.pCombinedImageSampler = &entry.image;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                get_info.data.pStorageImage = &entry.image;
+                break;
+            default:
+                UNREACHABLE_MSG("Invalid descriptor buffer type={}",
+                                static_cast<u32>(binding.type));
+                break;
+            }
+            u8* const descriptor{dst + binding.dst_offset + index * binding.descriptor_size};
+            dev.GetDescriptorEXT(get_info, binding.descriptor_size, descriptor);
+        }
+    }
+}
+
+DescriptorBufferRing::DescriptorBufferRing(const Device& device, MemoryAllocator& memory_allocator,
+                                           Scheduler& scheduler_)
+    : scheduler{scheduler_} {
+    if (!device.IsExtDescriptorBufferSupported()) {
+        return;
+    }
+    const auto& properties{device.DescriptorBufferProperties()};
+    alignment = properties.descriptorBufferOffsetAlignment;
+
+    // Combined image samplers live in the same buffer as resources, honor both limits
+    ring_size = std::min({MAX_RING_SIZE, properties.maxResourceDescriptorBufferRange,
+                          properties.maxSamplerDescriptorBufferRange});
+    ring_size = Common::AlignDown(ring_size, NUM_SYNCS * alignment);
+    region_size = ring_size / NUM_SYNCS;
+
+    buffer = memory_allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = ring_size,
+            .usage = RING_USAGE,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Stream);
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Descriptor Buffer Ring");
+    }
+    mapped = buffer.Mapped();
+    ASSERT_MSG(!mapped.empty(), "Descriptor buffer ring must be host visible!");
+
+    binding_info = VkDescriptorBufferBindingInfoEXT{
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+        .pNext = nullptr,
+        .address = device.GetLogical().GetBufferDeviceAddress(*buffer),
+        .usage = RING_USAGE,
+    };
+}
+
+DescriptorBufferRing::~DescriptorBufferRing() = default;
+
+VkDeviceSize DescriptorBufferRing::Allocate(VkDeviceSize size) {
+    const VkDeviceSize aligned_size{Common::AlignUp(size, alignment)};
+    ASSERT(aligned_size <= region_size);
+    if (iterator + aligned_size > ring_size) {
+        // Wrap around, every region has to be claimed again
+        iterator = 0;
+        free_iterator = 0;
+    }
+    const VkDeviceSize end{iterator + aligned_size};
+    const size_t end_region{Region(end - 1) + 1};
+    if (end > free_iterator) {
+        // Claim the regions the allocation grows into, the GPU may still be reading them
+        for (size_t region = Region(free_iterator); region < end_region; ++region) {
+            scheduler.Wait(sync_ticks[region]);
+        }
+        free_iterator = end_region * region_size;
+    }
+    std::fill(sync_ticks.begin() + Region(iterator), sync_ticks.begin() + end_region,
+              scheduler.CurrentTick());
+    const VkDeviceSize offset{iterator};
+    iterator = end;
+    return offset;
+}
+
+} // namespace Vulkan
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MemoryAllocator;
+class Scheduler;
+
+/// Describes where the descriptors of a set layout live in descriptor buffer memory
+/// (VK_EXT_descriptor_buffer) and writes them from an update queue payload.
+class DescriptorBufferLayout {
+public:
+    DescriptorBufferLayout() = default;
+    explicit DescriptorBufferLayout(const Device& device, VkDescriptorSetLayout set_layout,
+                                    std::span<const VkDescriptorUpdateTemplateEntry> entries);
+
+    /// Writes the descriptors of a payload laid out like the update template entries
+    void Write(u8* dst, const DescriptorUpdateEntry* payload) const;
+
+    /// Returns the size in bytes of a descriptor set with this layout
+    [[nodiscard]] VkDeviceSize Size() const noexcept {
+        return size;
+    }
+
+private:
+    struct Binding {
+        VkDescriptorType type;
+        u32 count;
+        size_t src_offset;
+        VkDeviceSize dst_offset;
+        size_t descriptor_size;
+    };
+
+    const Device* device{};
+    boost::container::small_vector<Binding, 32> bindings;
+    VkDeviceSize size{};
+};
+
+/// Host visible ring of memory descriptor sets are written to. Ranges are reused once the GPU
+/// has finished executing the ticks that referenced them.
+class DescriptorBufferRing {
+    static constexpr size_t NUM_SYNCS = 16;
+
+public:
+    explicit DescriptorBufferRing(const Device& device, MemoryAllocator& memory_allocator,
+                                  Scheduler& scheduler);
+    ~DescriptorBufferRing();
+
+    /// Returns the offset of a range of the given size, waits for the GPU when the ring is full.
+    /// The range can be used by commands recorded on the current tick.
+    [[nodiscard]] VkDeviceSize Allocate(VkDeviceSize size);
+
+    /// Returns a host pointer to the given offset of the ring
+    [[nodiscard]] u8* Pointer(VkDeviceSize offset) const noexcept {
+        return mapped.data() + offset;
+    }
+
+    /// Returns the binding of the ring to be passed to vkCmdBindDescriptorBuffersEXT
+    [[nodiscard]] const VkDescriptorBufferBindingInfoEXT& BindingInfo() const noexcept {
+        return binding_info;
+    }
+
+private:
+    size_t Region(VkDeviceSize iter) const noexcept {
+        return static_cast<size_t>(iter / region_size);
+    }
+
+    Scheduler& scheduler;
+
+    vk::Buffer buffer;
+    std::span<u8> mapped;
+    VkDescriptorBufferBindingInfoEXT binding_info{};
+    VkDeviceSize ring_size{};
+    VkDeviceSize region_size{};
+    VkDeviceSize alignment{};
+
+    VkDeviceSize iterator{};
+    VkDeviceSize free_iterator{};
+    std::array<u64, NUM_SYNCS> sync_ticks{};
+};
+
+} // namespace Vulkan
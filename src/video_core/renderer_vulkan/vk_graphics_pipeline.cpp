@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <span>
+#include <type_traits>
 
 #include <boost/container/small_vector.hpp>
 #include <boost/container/static_vector.hpp>
@@ -10,6 +11,7 @@
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 
 #include "common/bit_field.h"
+#include "common/cityhash.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -143,10 +145,10 @@ size_t NumAttachments(const FixedPipelineState& state) {
 }
 
 template <typename Spec>
-bool Passes(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+bool Passes(const std::array<bool, NUM_STAGES>& enabled_stages,
             const std::array<Shader::Info, NUM_STAGES>& stage_infos) {
     for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
-        if (!Spec::enabled_stages[stage] && modules[stage]) {
+        if (!Spec::enabled_stages[stage] && enabled_stages[stage]) {
             return false;
         }
         const auto& info{stage_infos[stage]};
@@ -174,14 +176,51 @@ bool Passes(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
     return true;
 }
 
+/// Accumulates the state consumed by a pipeline library part or a shader object into its key
+template <typename KeyType, typename IdentifierType>
+class StateKeyBuilder {
+public:
+    explicit StateKeyBuilder(IdentifierType identifier) : key{identifier} {}
+
+    template <typename T>
+    void Add(const T* values, size_t count) {
+        static_assert(std::has_unique_object_representations_v<T>);
+        const u8* const bytes{reinterpret_cast<const u8*>(values)};
+        key.state.insert(key.state.end(), bytes, bytes + count * sizeof(T));
+    }
+
+    template <typename T>
+    void Add(const T& value) {
+        Add(&value, 1);
+    }
+
+    /// Adds a range whose size varies, so that it can't be confused with the following state
+    template <typename Range>
+    void AddSized(const Range& values) {
+        Add(std::size(values));
+        Add(std::data(values), std::size(values));
+    }
+
+    [[nodiscard]] const KeyType& Key() const noexcept {
+        return key;
+    }
+
+private:
+    KeyType key;
+};
+
+using LibraryKeyBuilder =
+    StateKeyBuilder<GraphicsPipelineLibraryKey, VkGraphicsPipelineLibraryFlagsEXT>;
+using ShaderObjectKeyBuilder = StateKeyBuilder<ShaderObjectKey, VkShaderStageFlagBits>;
+
 using ConfigureFuncPtr = void (*)(GraphicsPipeline*, bool);
 
 template <typename Spec, typename... Specs>
-ConfigureFuncPtr FindSpec(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+ConfigureFuncPtr FindSpec(const std::array<bool, NUM_STAGES>& enabled_stages,
                           const std::array<Shader::Info, NUM_STAGES>& stage_infos) {
     if constexpr (sizeof...(Specs) > 0) {
-        if (!Passes<Spec>(modules, stage_infos)) {
-            return FindSpec<Specs...>(modules, stage_infos);
+        if (!Passes<Spec>(enabled_stages, stage_infos)) {
+            return FindSpec<Specs...>(enabled_stages, stage_infos);
         }
     }
     return GraphicsPipeline::MakeConfigureSpecFunc<Spec>();
@@ -227,54 +266,164 @@ struct DefaultSpec {
     static constexpr bool has_images = true;
 };
 
-ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& modules,
+ConfigureFuncPtr ConfigureFunc(const std::array<bool, NUM_STAGES>& enabled_stages,
                                const std::array<Shader::Info, NUM_STAGES>& infos) {
     return FindSpec<SimpleVertexSpec, SimpleVertexFragmentSpec, SimpleStorageSpec, SimpleImageSpec,
-                    DefaultSpec>(modules, infos);
+                    DefaultSpec>(enabled_stages, infos);
 }
 } // Anonymous namespace
 
+size_t GraphicsPipelineLibraryKey::Hash() const noexcept {
+    return static_cast<size_t>(Common::CityHash64WithSeed(
+        reinterpret_cast<const char*>(state.data()), state.size(), part));
+}
+
+bool GraphicsPipelineLibraryKey::operator==(const GraphicsPipelineLibraryKey& rhs) const noexcept {
+    return part == rhs.part && state == rhs.state;
+}
+
+size_t ShaderObjectKey::Hash() const noexcept {
+    return static_cast<size_t>(Common::CityHash64WithSeed(
+        reinterpret_cast<const char*>(state.data()), state.size(), stage));
+}
+
+bool ShaderObjectKey::operator==(const ShaderObjectKey& rhs) const noexcept {
+    return stage == rhs.stage && state == rhs.state;
+}
+
+GraphicsPipelineLibraryCache::GraphicsPipelineLibraryCache(const Device& device_,
+                                                           vk::PipelineCache& pipeline_cache_)
+    : device{device_}, pipeline_cache{pipeline_cache_} {}
+
+GraphicsPipelineLibraryCache::~GraphicsPipelineLibraryCache() = default;
+
+VkPipeline GraphicsPipelineLibraryCache::Get(const GraphicsPipelineLibraryKey& key,
+                                             const VkGraphicsPipelineCreateInfo& ci) {
+    {
+        std::scoped_lock lock{mutex};
+        if (const auto it = libraries.find(key); it != libraries.end()) {
+            return *it->second;
+        }
+    }
+    const VkGraphicsPipelineLibraryCreateInfoEXT library_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+        .pNext = ci.pNext,
+        .flags = key.part,
+    };
+    VkGraphicsPipelineCreateInfo part_ci{ci};
+    part_ci.pNext = &library_ci;
+    part_ci.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+
+    // Build without holding the lock, other workers may be building unrelated parts
+    vk::Pipeline library{device.GetLogical().CreateGraphicsPipeline(part_ci, *pipeline_cache)};
+
+    std::scoped_lock lock{mutex};
+    // If another worker built the same part in the meantime, keep the first one
+    const auto [it, is_new] = libraries.try_emplace(key, std::move(library));
+    return *it->second;
+}
+
+ShaderObjectCache::ShaderObjectCache(const Device& device_) : device{device_} {}
+
+ShaderObjectCache::~ShaderObjectCache() = default;
+
+VkShaderEXT ShaderObjectCache::Get(const ShaderObjectKey& key, const VkShaderCreateInfoEXT& ci) {
+    {
+        std::scoped_lock lock{mutex};
+        if (const auto it = shaders.find(key); it != shaders.end()) {
+            return *it->second;
+        }
+    }
+    vk::ShaderEXT shader{device.GetLogical().CreateShaderEXT(ci)};
+
+    std::scoped_lock lock{mutex};
+    const auto [it, is_new] = shaders.try_emplace(key, std::move(shader));
+    return *it->second;
+}
+
 GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
     vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
     const Device& device_, DescriptorPool& descriptor_pool,
-    GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
-    PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-    const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
+    GuestDescriptorQueue& guest_descriptor_queue_, DescriptorBufferRing* descriptor_buffer_ring_,
+    Common::ThreadWorker* worker_thread, PipelineStatistics* pipeline_statistics,
+    RenderPassCache& render_pass_cache, GraphicsPipelineLibraryCache* library_cache,
+    Common::ThreadWorker* optimize_thread, ShaderObjectCache* shader_object_cache,
+    const GraphicsPipelineCacheKey& key_,
+    std::array<vk::ShaderModule, NUM_STAGES> stages,
+    std::array<std::vector<u32>, NUM_STAGES> stage_code,
     const std::array<const Shader::Info*, NUM_STAGES>& infos)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
       pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      guest_descriptor_queue{guest_descriptor_queue_},
+      descriptor_buffer_ring{descriptor_buffer_ring_}, spv_modules{std::move(stages)},
+      spv_code{std::move(stage_code)}, uses_shader_objects{shader_object_cache != nullptr},
+      has_tessellation_stages{infos[1] != nullptr || infos[2] != nullptr} {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
+    std::array<bool, NUM_STAGES> enabled_stages{};
     for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
         const Shader::Info* const info{infos[stage]};
         if (!info) {
             continue;
         }
+        enabled_stages[stage] = true;
         stage_infos[stage] = *info;
         enabled_uniform_buffer_masks[stage] = info->constant_buffer_mask;
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
-        uses_push_descriptor = builder.CanUsePushDescriptor();
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
+    // Draws may reserve descriptor buffer space before the pipeline has been built, the layouts
+    // have to be known ahead of the build
+    DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
+    uses_descriptor_buffer = descriptor_buffer_ring != nullptr && builder.CanUseDescriptorBuffer();
+    uses_push_descriptor = !uses_descriptor_buffer && builder.CanUsePushDescriptor();
+    descriptor_set_layout =
+        builder.CreateDescriptorSetLayout(uses_push_descriptor, uses_descriptor_buffer);
+    const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
+    pipeline_layout = builder.CreatePipelineLayout(set_layout);
+    if (uses_descriptor_buffer) {
+        descriptor_buffer_layout = builder.CreateDescriptorBufferLayout(set_layout);
+    } else {
         if (!uses_push_descriptor) {
-            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+            descriptor_allocator = descriptor_pool.Allocator(set_layout, stage_infos);
         }
-        const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
-        pipeline_layout = builder.CreatePipelineLayout(set_layout);
         descriptor_update_template =
             builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+    }
 
-        const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
+    auto func{[this, shader_notify, &render_pass_cache, pipeline_statistics, library_cache,
+               optimize_thread, shader_object_cache,
+               push_constant_range = builder.PushConstantRange()] {
         Validate();
-        MakePipeline(render_pass);
-        if (pipeline_statistics) {
-            pipeline_statistics->Collect(*pipeline);
+
+        if (shader_object_cache) {
+            // Render state is set dynamically at draw time, there is no pipeline to build
+            MakeShaderObjects(*shader_object_cache, push_constant_range);
+        } else {
+            // Pipelines drawing with dynamic rendering are built against attachment formats
+            VkRenderPass render_pass{};
+            if (!device.UsesDynamicRendering()) {
+                render_pass = render_pass_cache.Get(MakeRenderPassKey(key.state));
+            }
+
+            // Statistics are only meaningful on fully optimized pipelines, skip libraries then
+            const bool fast_link{library_cache && optimize_thread && !pipeline_statistics};
+            pipeline = MakePipeline(render_pass, fast_link ? library_cache : nullptr);
+            current_pipeline.store(*pipeline, std::memory_order::release);
+            // The code was only kept to look up library parts
+            spv_code = {};
+            if (pipeline_statistics) {
+                pipeline_statistics->Collect(*pipeline);
+            }
+            if (fast_link) {
+                // Draw with the linked libraries until the optimized pipeline is ready
+                optimize_thread->QueueWork([this, render_pass] {
+                    optimized_pipeline = MakePipeline(render_pass, nullptr);
+                    current_pipeline.store(*optimized_pipeline, std::memory_order::release);
+                });
+            }
         }
 
         std::scoped_lock lock{build_mutex};
@@ -289,12 +438,7 @@ GraphicsPipeline::GraphicsPipeline(
     } else {
         func();
     }
-    configure_func = ConfigureFunc(spv_modules, stage_infos);
-}
-
-void GraphicsPipeline::AddTransition(GraphicsPipeline* transition) {
-    transition_keys.push_back(transition->key);
-    transitions.push_back(transition);
+    configure_func = ConfigureFunc(enabled_stages, stage_infos);
 }
 
 template <typename Spec>
@@ -304,6 +448,13 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
     size_t sampler_index{};
     size_t view_index{};
 
+    // Reserve descriptor memory before anything is recorded, waiting on a full ring may flush
+    VkDeviceSize descriptor_buffer_offset{};
+    if (uses_descriptor_buffer) {
+        const VkDeviceSize size{descriptor_buffer_layout.Size()};
+        descriptor_buffer_offset = descriptor_buffer_ring->Allocate(size);
+    }
+
     texture_cache.SynchronizeGraphicsDescriptors();
 
     buffer_cache.SetUniformBuffersState(enabled_uniform_buffer_masks, &uniform_buffer_sizes);
@@ -485,12 +636,17 @@ void GraphicsPipeline::ConfigureImpl(bool is_indexed) {
     }
     texture_cache.UpdateRenderTargets(false);
     texture_cache.CheckFeedbackLoop(views);
-    ConfigureDraw(rescaling, render_area);
+    ConfigureDraw(rescaling, render_area, descriptor_buffer_offset);
 }
 
 void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
-                                     const RenderAreaPushConstant& render_area) {
-    scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
+                                     const RenderAreaPushConstant& render_area,
+                                     VkDeviceSize descriptor_buffer_offset) {
+    if (uses_shader_objects) {
+        scheduler.RequestRendering(texture_cache.GetFramebuffer());
+    } else {
+        scheduler.RequestRenderpass(texture_cache.GetFramebuffer());
+    }
 
     if (!is_built.load(std::memory_order::relaxed)) {
         // Wait for the pipeline to be built
@@ -501,14 +657,34 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     }
     const bool is_rescaling{texture_cache.IsRescaling()};
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
-    const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
-    const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
+    // Rebind when the optimized pipeline has been swapped in since the last draw
+    const VkPipeline pipeline_handle{current_pipeline.load(std::memory_order::acquire)};
+    const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this, pipeline_handle)};
+    const bool bind_descriptor_buffer{uses_descriptor_buffer &&
+                                      scheduler.UpdateDescriptorBuffer()};
+    const DescriptorUpdateEntry* const descriptor_data{guest_descriptor_queue.UpdateData()};
+    scheduler.Record([this, descriptor_data, pipeline_handle, bind_pipeline, bind_descriptor_buffer,
+                      descriptor_buffer_offset, rescaling_data = rescaling.Data(),
                       is_rescaling, update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
-        if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+        if (bind_pipeline && uses_shader_objects) {
+            static constexpr std::array<VkShaderStageFlagBits, NUM_STAGES> stages{
+                VK_SHADER_STAGE_VERTEX_BIT,
+                VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+                VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT,
+                VK_SHADER_STAGE_GEOMETRY_BIT,
+                VK_SHADER_STAGE_FRAGMENT_BIT,
+            };
+            // Unused stages are bound to null handles
+            cmdbuf.BindShadersEXT(stages, shader_objects.data());
+        } else if (bind_pipeline) {
+            VkPipeline handle{pipeline_handle};
+            if (!handle) {
+                // The pipeline was still being built when this draw was recorded
+                handle = current_pipeline.load(std::memory_order::acquire);
+            }
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, handle);
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -528,7 +704,16 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
         if (!descriptor_set_layout) {
             return;
         }
-        if (uses_push_descriptor) {
+        if (uses_descriptor_buffer) {
+            if (bind_descriptor_buffer) {
+                cmdbuf.BindDescriptorBuffersEXT(descriptor_buffer_ring->BindingInfo());
+            }
+            u8* const descriptors{descriptor_buffer_ring->Pointer(descriptor_buffer_offset)};
+            descriptor_buffer_layout.Write(descriptors, descriptor_data);
+            const u32 buffer_index{0};
+            cmdbuf.SetDescriptorBufferOffsetsEXT(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline_layout,
+                                                 0, buffer_index, descriptor_buffer_offset);
+        } else if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
                                                     0, descriptor_data);
         } else {
@@ -541,7 +726,8 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+vk::Pipeline GraphicsPipeline::MakePipeline(VkRenderPass render_pass,
+                                           GraphicsPipelineLibraryCache* libraries) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -874,26 +1060,146 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         }
         */
     }
-    VkPipelineCreateFlags flags{};
+    // Every library and the linked pipeline have to agree on the use of descriptor buffers
+    const VkPipelineCreateFlags descriptor_flags{
+        uses_descriptor_buffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0U};
+    VkPipelineCreateFlags flags{descriptor_flags};
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
-    pipeline = device.GetLogical().CreateGraphicsPipeline(
+    const RenderPassKey render_pass_key{MakeRenderPassKey(key.state)};
+    const PipelineRenderingInfo rendering_info(device, render_pass_key);
+    const VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = render_pass ? nullptr : &rendering_info.ci,
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = render_pass,
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    if (!libraries) {
+        return device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+    }
+
+    // Split the pipeline into its four library parts. Each part is keyed only by the state it
+    // consumes, so pipelines that differ in unrelated state share the same library.
+    LibraryKeyBuilder vertex_input{VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT};
+    vertex_input.AddSized(vertex_bindings);
+    vertex_input.AddSized(vertex_binding_divisors);
+    vertex_input.AddSized(vertex_attributes);
+    vertex_input.Add(input_assembly_ci.topology);
+    vertex_input.Add(input_assembly_ci.primitiveRestartEnable);
+
+    LibraryKeyBuilder pre_rasterization{
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT};
+    for (size_t stage = 0; stage < NUM_STAGES - 1; ++stage) {
+        pre_rasterization.AddSized(spv_code[stage]);
+    }
+    pre_rasterization.Add(input_assembly_ci.topology);
+    pre_rasterization.Add(tessellation_ci.patchControlPoints);
+    pre_rasterization.AddSized(swizzles);
+    pre_rasterization.Add(ndc_info.negativeOneToOne);
+    pre_rasterization.Add(num_viewports);
+    pre_rasterization.Add(rasterization_ci.depthClampEnable);
+    pre_rasterization.Add(rasterization_ci.rasterizerDiscardEnable);
+    pre_rasterization.Add(rasterization_ci.polygonMode);
+    pre_rasterization.Add(rasterization_ci.cullMode);
+    pre_rasterization.Add(rasterization_ci.frontFace);
+    pre_rasterization.Add(rasterization_ci.depthBiasEnable);
+    pre_rasterization.Add(line_state.lineRasterizationMode);
+    pre_rasterization.Add(conservative_raster.conservativeRasterizationMode);
+    pre_rasterization.Add(provoking_vertex.provokingVertexMode);
+
+    LibraryKeyBuilder fragment_shader{VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT};
+    fragment_shader.AddSized(spv_code[NUM_STAGES - 1]);
+    fragment_shader.Add(depth_stencil_ci.depthTestEnable);
+    fragment_shader.Add(depth_stencil_ci.depthWriteEnable);
+    fragment_shader.Add(depth_stencil_ci.depthCompareOp);
+    fragment_shader.Add(depth_stencil_ci.depthBoundsTestEnable);
+    fragment_shader.Add(depth_stencil_ci.stencilTestEnable);
+    fragment_shader.Add(depth_stencil_ci.front);
+    fragment_shader.Add(depth_stencil_ci.back);
+
+    LibraryKeyBuilder fragment_output{
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT};
+    fragment_output.AddSized(cb_attachments);
+    fragment_output.Add(color_blend_ci.logicOpEnable);
+    fragment_output.Add(color_blend_ci.logicOp);
+
+    for (LibraryKeyBuilder* const part :
+         {&pre_rasterization, &fragment_shader, &fragment_output}) {
+        part->Add(render_pass_key);
+        part->Add(multisample_ci.rasterizationSamples);
+        part->Add(multisample_ci.alphaToCoverageEnable);
+        part->Add(multisample_ci.alphaToOneEnable);
+    }
+    // Shader stages have to be built against the same descriptor set layout
+    const DescriptorLayoutBuilder layout_builder{MakeBuilder(device, stage_infos)};
+    for (LibraryKeyBuilder* const part : {&pre_rasterization, &fragment_shader}) {
+        part->AddSized(layout_builder.Bindings());
+        part->Add(uses_push_descriptor);
+    }
+    for (LibraryKeyBuilder* const part :
+         {&vertex_input, &pre_rasterization, &fragment_shader, &fragment_output}) {
+        part->AddSized(dynamic_states);
+        part->Add(descriptor_flags);
+    }
+
+    // The fragment stage is always the last one, libraries must only contain their own stages
+    const bool has_fragment_stage{static_cast<bool>(spv_modules[NUM_STAGES - 1])};
+    const std::span<const VkPipelineShaderStageCreateInfo> stages{shader_stages};
+    const std::span pre_rasterization_stages{stages.first(stages.size() - has_fragment_stage)};
+    const std::span fragment_stages{stages.last(has_fragment_stage ? 1 : 0)};
+    const auto make_library{[&](const LibraryKeyBuilder& part,
+                                std::span<const VkPipelineShaderStageCreateInfo> part_stages) {
+        VkGraphicsPipelineCreateInfo library_ci{pipeline_ci};
+        library_ci.flags = descriptor_flags;
+        library_ci.stageCount = static_cast<u32>(part_stages.size());
+        library_ci.pStages = part_stages.data();
+        return libraries->Get(part.Key(), library_ci);
+    }};
+    const std::array library_handles{
+        make_library(vertex_input, {}),
+        make_library(pre_rasterization, pre_rasterization_stages),
+        make_library(fragment_shader, fragment_stages),
+        make_library(fragment_output, {}),
+    };
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(library_handles.size()),
+        .pLibraries = library_handles.data(),
+    };
+    // Linking without link time optimization is fast enough to be done on first use
+    return device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
+            .pNext = &library_ci,
+            .flags = descriptor_flags,
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
             .layout = *pipeline_layout,
             .renderPass = render_pass,
             .subpass = 0,
@@ -903,6 +1209,56 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         *pipeline_cache);
 }
 
+void GraphicsPipeline::MakeShaderObjects(ShaderObjectCache& shader_object_cache,
+                                         const VkPushConstantRange& push_constant_range) {
+    static constexpr std::array<VkShaderStageFlags, NUM_STAGES> next_stages{
+        VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_GEOMETRY_BIT |
+            VK_SHADER_STAGE_FRAGMENT_BIT,
+        VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT,
+        VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+        VK_SHADER_STAGE_FRAGMENT_BIT,
+        0,
+    };
+    const DescriptorLayoutBuilder layout_builder{MakeBuilder(device, stage_infos)};
+    const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
+    for (size_t stage = 0; stage < NUM_STAGES; ++stage) {
+        std::vector<u32>& code{spv_code[stage]};
+        if (code.empty()) {
+            continue;
+        }
+        // Shaders are created unlinked with every possible next stage, the same object can be
+        // shared by all pipelines using this code with the same descriptor layout
+        const VkShaderStageFlagBits shader_stage{
+            MaxwellToVK::ShaderStage(Shader::StageFromIndex(stage))};
+        const VkShaderCreateInfoEXT shader_ci{
+            .sType = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT,
+            .pNext = nullptr,
+            .flags = 0,
+            .stage = shader_stage,
+            .nextStage = next_stages[stage],
+            .codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT,
+            .codeSize = code.size() * sizeof(u32),
+            .pCode = code.data(),
+            .pName = "main",
+            .setLayoutCount = descriptor_set_layout ? 1U : 0U,
+            .pSetLayouts = descriptor_set_layout ? &set_layout : nullptr,
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges = &push_constant_range,
+            .pSpecializationInfo = nullptr,
+        };
+        ShaderObjectKeyBuilder shader_key{shader_stage};
+        shader_key.AddSized(code);
+        shader_key.AddSized(layout_builder.Bindings());
+        shader_key.Add(uses_push_descriptor);
+        shader_key.Add(uses_descriptor_buffer);
+        shader_key.Add(push_constant_range);
+        shader_objects[stage] = shader_object_cache.Get(shader_key.Key(), shader_ci);
+
+        // The code is no longer needed once the shader object exists
+        std::vector<u32>().swap(code);
+    }
+}
+
 void GraphicsPipeline::Validate() {
     size_t num_images{};
     for (const auto& info : stage_infos) {
@@ -8,13 +8,17 @@
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <span>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "common/thread_worker.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -31,6 +35,10 @@ struct GraphicsPipelineCacheKey {
 
     size_t Hash() const noexcept;
 
+    /// Returns the hash of the key from already computed hashes of the state groups
+    size_t Hash(std::span<const u64, FixedPipelineState::NumHashGroups> state_group_hashes)
+        const noexcept;
+
     bool operator==(const GraphicsPipelineCacheKey& rhs) const noexcept;
 
     bool operator!=(const GraphicsPipelineCacheKey& rhs) const noexcept {
@@ -45,6 +53,34 @@ static_assert(std::has_unique_object_representations_v<GraphicsPipelineCacheKey>
 static_assert(std::is_trivially_copyable_v<GraphicsPipelineCacheKey>);
 static_assert(std::is_trivially_constructible_v<GraphicsPipelineCacheKey>);
 
+/// State consumed by a pipeline library part, parts are only shared when all of it matches
+struct GraphicsPipelineLibraryKey {
+    VkGraphicsPipelineLibraryFlagsEXT part{};
+    std::vector<u8> state;
+
+    size_t Hash() const noexcept;
+
+    bool operator==(const GraphicsPipelineLibraryKey& rhs) const noexcept;
+
+    bool operator!=(const GraphicsPipelineLibraryKey& rhs) const noexcept {
+        return !operator==(rhs);
+    }
+};
+
+/// Code and layout of an unlinked shader object, objects are only shared when all of it matches
+struct ShaderObjectKey {
+    VkShaderStageFlagBits stage{};
+    std::vector<u8> state;
+
+    size_t Hash() const noexcept;
+
+    bool operator==(const ShaderObjectKey& rhs) const noexcept;
+
+    bool operator!=(const ShaderObjectKey& rhs) const noexcept {
+        return !operator==(rhs);
+    }
+};
+
 } // namespace Vulkan
 
 namespace std {
@@ -54,6 +90,20 @@ struct hash<Vulkan::GraphicsPipelineCacheKey> {
         return k.Hash();
     }
 };
+
+template <>
+struct hash<Vulkan::GraphicsPipelineLibraryKey> {
+    size_t operator()(const Vulkan::GraphicsPipelineLibraryKey& k) const noexcept {
+        return k.Hash();
+    }
+};
+
+template <>
+struct hash<Vulkan::ShaderObjectKey> {
+    size_t operator()(const Vulkan::ShaderObjectKey& k) const noexcept {
+        return k.Hash();
+    }
+};
 } // namespace std
 
 namespace Vulkan {
@@ -65,6 +115,38 @@ class RescalingPushConstant;
 class RenderAreaPushConstant;
 class Scheduler;
 
+/// Pipeline library parts (VK_EXT_graphics_pipeline_library) shared between graphics pipelines
+class GraphicsPipelineLibraryCache {
+public:
+    explicit GraphicsPipelineLibraryCache(const Device& device,
+                                          vk::PipelineCache& pipeline_cache);
+    ~GraphicsPipelineLibraryCache();
+
+    /// Returns the library part matching the key, creating it if needed
+    VkPipeline Get(const GraphicsPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& ci);
+
+private:
+    const Device& device;
+    vk::PipelineCache& pipeline_cache;
+    std::mutex mutex;
+    std::unordered_map<GraphicsPipelineLibraryKey, vk::Pipeline> libraries;
+};
+
+/// Unlinked shader objects (VK_EXT_shader_object) shared between graphics pipelines
+class ShaderObjectCache {
+public:
+    explicit ShaderObjectCache(const Device& device);
+    ~ShaderObjectCache();
+
+    /// Returns the shader object matching the key, creating it if needed
+    VkShaderEXT Get(const ShaderObjectKey& key, const VkShaderCreateInfoEXT& ci);
+
+private:
+    const Device& device;
+    std::mutex mutex;
+    std::unordered_map<ShaderObjectKey, vk::ShaderEXT> shaders;
+};
+
 class GraphicsPipeline {
     static constexpr size_t NUM_STAGES = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
 
@@ -73,9 +155,13 @@ public:
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
         vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
         const Device& device, DescriptorPool& descriptor_pool,
-        GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
-        PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-        const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
+        GuestDescriptorQueue& guest_descriptor_queue, DescriptorBufferRing* descriptor_buffer_ring,
+        Common::ThreadWorker* worker_thread, PipelineStatistics* pipeline_statistics,
+        RenderPassCache& render_pass_cache, GraphicsPipelineLibraryCache* library_cache,
+        Common::ThreadWorker* optimize_thread, ShaderObjectCache* shader_object_cache,
+        const GraphicsPipelineCacheKey& key,
+        std::array<vk::ShaderModule, NUM_STAGES> stages,
+        std::array<std::vector<u32>, NUM_STAGES> stage_code,
         const std::array<const Shader::Info*, NUM_STAGES>& infos);
 
     GraphicsPipeline& operator=(GraphicsPipeline&&) noexcept = delete;
@@ -84,19 +170,12 @@ public:
     GraphicsPipeline& operator=(const GraphicsPipeline&) = delete;
     GraphicsPipeline(const GraphicsPipeline&) = delete;
 
-    void AddTransition(GraphicsPipeline* transition);
-
     void Configure(bool is_indexed) {
         configure_func(this, is_indexed);
     }
 
-    [[nodiscard]] GraphicsPipeline* Next(const GraphicsPipelineCacheKey& current_key) noexcept {
-        if (key == current_key) {
-            return this;
-        }
-        const auto it{std::find(transition_keys.begin(), transition_keys.end(), current_key)};
-        return it != transition_keys.end() ? transitions[std::distance(transition_keys.begin(), it)]
-                                           : nullptr;
+    [[nodiscard]] const GraphicsPipelineCacheKey& Key() const noexcept {
+        return key;
     }
 
     [[nodiscard]] bool IsBuilt() const noexcept {
@@ -113,14 +192,27 @@ public:
         gpu_memory = gpu_memory_;
     }
 
+    /// Returns true when the pipeline draws with shader objects instead of a pipeline object
+    [[nodiscard]] bool UsesShaderObjects() const noexcept {
+        return uses_shader_objects;
+    }
+
+    [[nodiscard]] bool HasTessellationStages() const noexcept {
+        return has_tessellation_stages;
+    }
+
 private:
     template <typename Spec>
     void ConfigureImpl(bool is_indexed);
 
     void ConfigureDraw(const RescalingPushConstant& rescaling,
-                       const RenderAreaPushConstant& render_are);
+                       const RenderAreaPushConstant& render_are,
+                       VkDeviceSize descriptor_buffer_offset);
+
+    vk::Pipeline MakePipeline(VkRenderPass render_pass, GraphicsPipelineLibraryCache* libraries);
 
-    void MakePipeline(VkRenderPass render_pass);
+    void MakeShaderObjects(ShaderObjectCache& shader_object_cache,
+                           const VkPushConstantRange& push_constant_range);
 
     void Validate();
 
@@ -133,13 +225,12 @@ private:
     vk::PipelineCache& pipeline_cache;
     Scheduler& scheduler;
     GuestDescriptorQueue& guest_descriptor_queue;
+    DescriptorBufferRing* descriptor_buffer_ring;
 
     void (*configure_func)(GraphicsPipeline*, bool){};
 
-    std::vector<GraphicsPipelineCacheKey> transition_keys;
-    std::vector<GraphicsPipeline*> transitions;
-
     std::array<vk::ShaderModule, NUM_STAGES> spv_modules;
+    std::array<std::vector<u32>, NUM_STAGES> spv_code;
 
     std::array<Shader::Info, NUM_STAGES> stage_infos;
     std::array<u32, 5> enabled_uniform_buffer_masks{};
@@ -150,12 +241,19 @@ private:
     DescriptorAllocator descriptor_allocator;
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
+    DescriptorBufferLayout descriptor_buffer_layout;
     vk::Pipeline pipeline;
+    vk::Pipeline optimized_pipeline;
+    std::atomic<VkPipeline> current_pipeline{};
+    std::array<VkShaderEXT, NUM_STAGES> shader_objects{};
 
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
     bool uses_push_descriptor{false};
+    bool uses_descriptor_buffer{false};
+    bool uses_shader_objects{false};
+    bool has_tessellation_stages{false};
 };
 
 } // namespace Vulkan
@@ -3,6 +3,7 @@
 
 #include <thread>
 
+#include "common/assert.h"
 #include "common/polyfill_ranges.h"
 #include "common/settings.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
@@ -13,7 +14,11 @@ namespace Vulkan {
 
 constexpr u64 FENCE_RESERVE_SIZE = 8;
 
-MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
+MasterSemaphore::MasterSemaphore(const Device& device_)
+    : MasterSemaphore(device_, device_.GetGraphicsQueue()) {}
+
+MasterSemaphore::MasterSemaphore(const Device& device_, vk::Queue queue_)
+    : device(device_), queue(queue_) {
     if (!device.HasTimelineSemaphore()) {
         static constexpr VkFenceCreateInfo fence_ci{
             .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .pNext = nullptr, .flags = 0};
@@ -100,40 +105,51 @@ void MasterSemaphore::Wait(u64 tick) {
     Refresh();
 }
 
-VkResult MasterSemaphore::SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
+VkResult MasterSemaphore::SubmitQueue(std::span<const VkCommandBuffer> cmdbufs,
                                       VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
-                                      u64 host_tick) {
+                                      u64 host_tick, VkSemaphore wait_timeline,
+                                      u64 wait_timeline_value) {
     if (semaphore) {
-        return SubmitQueueTimeline(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore,
-                                   host_tick);
+        return SubmitQueueTimeline(cmdbufs, signal_semaphore, wait_semaphore, host_tick,
+                                   wait_timeline, wait_timeline_value);
     } else {
-        return SubmitQueueFence(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, host_tick);
+        ASSERT_MSG(!wait_timeline, "Timeline waits require timeline semaphore support");
+        return SubmitQueueFence(cmdbufs, signal_semaphore, wait_semaphore, host_tick);
     }
 }
 
+// Timeline waits on other queues come second, their results can be consumed by any stage
 static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
 };
 
-VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
-                                              vk::CommandBuffer& upload_cmdbuf,
+VkResult MasterSemaphore::SubmitQueueTimeline(std::span<const VkCommandBuffer> cmdbufs,
                                               VkSemaphore signal_semaphore,
-                                              VkSemaphore wait_semaphore, u64 host_tick) {
+                                              VkSemaphore wait_semaphore, u64 host_tick,
+                                              VkSemaphore wait_timeline, u64 wait_timeline_value) {
     const VkSemaphore timeline_semaphore = *semaphore;
 
     const u32 num_signal_semaphores = signal_semaphore ? 2 : 1;
     const std::array signal_values{host_tick, u64(0)};
     const std::array signal_semaphores{timeline_semaphore, signal_semaphore};
 
-    const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
-
-    const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
+    // Binary semaphores ignore their wait value
+    u32 num_wait_semaphores = 0;
+    std::array<VkSemaphore, 2> wait_semaphores{};
+    std::array<u64, 2> wait_values{};
+    if (wait_semaphore) {
+        wait_semaphores[num_wait_semaphores++] = wait_semaphore;
+    }
+    if (wait_timeline) {
+        wait_semaphores[num_wait_semaphores] = wait_timeline;
+        wait_values[num_wait_semaphores++] = wait_timeline_value;
+    }
     const VkTimelineSemaphoreSubmitInfo timeline_si{
         .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
         .pNext = nullptr,
-        .waitSemaphoreValueCount = 0,
-        .pWaitSemaphoreValues = nullptr,
+        .waitSemaphoreValueCount = num_wait_semaphores,
+        .pWaitSemaphoreValues = wait_values.data(),
         .signalSemaphoreValueCount = num_signal_semaphores,
         .pSignalSemaphoreValues = signal_values.data(),
     };
@@ -141,40 +157,37 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
         .pNext = &timeline_si,
         .waitSemaphoreCount = num_wait_semaphores,
-        .pWaitSemaphores = &wait_semaphore,
+        .pWaitSemaphores = wait_semaphores.data(),
         .pWaitDstStageMask = wait_stage_masks.data(),
-        .commandBufferCount = static_cast<u32>(cmdbuffers.size()),
-        .pCommandBuffers = cmdbuffers.data(),
+        .commandBufferCount = static_cast<u32>(cmdbufs.size()),
+        .pCommandBuffers = cmdbufs.data(),
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = signal_semaphores.data(),
     };
 
-    return device.GetGraphicsQueue().Submit(submit_info);
+    return queue.Submit(submit_info);
 }
 
-VkResult MasterSemaphore::SubmitQueueFence(vk::CommandBuffer& cmdbuf,
-                                           vk::CommandBuffer& upload_cmdbuf,
+VkResult MasterSemaphore::SubmitQueueFence(std::span<const VkCommandBuffer> cmdbufs,
                                            VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                                            u64 host_tick) {
     const u32 num_signal_semaphores = signal_semaphore ? 1 : 0;
     const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
 
-    const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
-
     const VkSubmitInfo submit_info{
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
         .pNext = nullptr,
         .waitSemaphoreCount = num_wait_semaphores,
         .pWaitSemaphores = &wait_semaphore,
         .pWaitDstStageMask = wait_stage_masks.data(),
-        .commandBufferCount = static_cast<u32>(cmdbuffers.size()),
-        .pCommandBuffers = cmdbuffers.data(),
+        .commandBufferCount = static_cast<u32>(cmdbufs.size()),
+        .pCommandBuffers = cmdbufs.data(),
         .signalSemaphoreCount = num_signal_semaphores,
         .pSignalSemaphores = &signal_semaphore,
     };
 
     auto fence = GetFreeFence();
-    auto result = device.GetGraphicsQueue().Submit(submit_info, *fence);
+    auto result = queue.Submit(submit_info, *fence);
 
     if (result == VK_SUCCESS) {
         std::scoped_lock lock{wait_mutex};
@@ -7,6 +7,7 @@
 #include <condition_variable>
 #include <deque>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <queue>
 
@@ -23,6 +24,7 @@ class MasterSemaphore {
 
 public:
     explicit MasterSemaphore(const Device& device);
+    explicit MasterSemaphore(const Device& device, vk::Queue queue);
     ~MasterSemaphore();
 
     /// Returns the current logical tick.
@@ -35,6 +37,11 @@ public:
         return gpu_tick.load(std::memory_order_acquire);
     }
 
+    /// Returns the timeline semaphore, null when timeline semaphores are not supported.
+    [[nodiscard]] VkSemaphore Handle() const noexcept {
+        return *semaphore;
+    }
+
     /// Returns true when a tick has been hit by the GPU.
     [[nodiscard]] bool IsFree(u64 tick) const noexcept {
         return KnownGpuTick() >= tick;
@@ -51,15 +58,19 @@ public:
     /// Waits for a tick to be hit on the GPU
     void Wait(u64 tick);
 
-    /// Submits the device graphics queue, updating the tick as necessary
-    VkResult SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
-                         VkSemaphore signal_semaphore, VkSemaphore wait_semaphore, u64 host_tick);
+    /// Submits the queue of the semaphore, updating the tick as necessary
+    /// Command buffers are submitted in the given order
+    /// Optionally waits for another timeline semaphore to reach a value before executing
+    VkResult SubmitQueue(std::span<const VkCommandBuffer> cmdbufs, VkSemaphore signal_semaphore,
+                         VkSemaphore wait_semaphore, u64 host_tick,
+                         VkSemaphore wait_timeline = VK_NULL_HANDLE, u64 wait_timeline_value = 0);
 
 private:
-    VkResult SubmitQueueTimeline(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
+    VkResult SubmitQueueTimeline(std::span<const VkCommandBuffer> cmdbufs,
                                  VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
-                                 u64 host_tick);
-    VkResult SubmitQueueFence(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
+                                 u64 host_tick, VkSemaphore wait_timeline,
+                                 u64 wait_timeline_value);
+    VkResult SubmitQueueFence(std::span<const VkCommandBuffer> cmdbufs,
                               VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                               u64 host_tick);
 
@@ -69,6 +80,7 @@ private:
 
 private:
     const Device& device;             ///< Device.
+    vk::Queue queue;                  ///< Queue submissions are sent to.
     vk::Semaphore semaphore;          ///< Timeline semaphore.
     std::atomic<u64> gpu_tick{0};     ///< Current known GPU tick.
     std::atomic<u64> current_tick{1}; ///< Current logical tick.
@@ -2,14 +2,18 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <exception>
 #include <fstream>
 #include <memory>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "common/bit_cast.h"
 #include "common/cityhash.h"
+#include "common/container_hash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/microprofile.h"
@@ -43,6 +47,7 @@ namespace Vulkan {
 MICROPROFILE_DECLARE(Vulkan_PipelineCache);
 
 namespace {
+using Shader::Backend::SPIRV::AssignBindings;
 using Shader::Backend::SPIRV::EmitSPIRV;
 using Shader::Maxwell::ConvertLegacyToGeneric;
 using Shader::Maxwell::GenerateGeometryPassthrough;
@@ -278,6 +283,22 @@ size_t GetTotalPipelineWorkers() {
 #endif
 }
 
+/// Clears the state shader objects set at draw time, so it does not split the pipeline cache
+void ClearShaderObjectDynamicState(FixedPipelineState& state) {
+    state.polygon_mode.Assign(0);
+    state.patch_control_points_minus_one.Assign(0);
+    state.msaa_mode.Assign(Tegra::Texture::MsaaMode::Msaa1x1);
+    state.depth_enabled.Assign(0);
+    state.depth_format.Assign(0);
+    state.provoking_vertex_last.Assign(0);
+    state.conservative_raster_enable.Assign(0);
+    state.smooth_lines.Assign(0);
+    state.alpha_to_coverage_enabled.Assign(0);
+    state.alpha_to_one_enabled.Assign(0);
+    state.color_formats.fill(0);
+    state.viewport_swizzles.fill(0);
+}
+
 } // Anonymous namespace
 
 size_t ComputePipelineCacheKey::Hash() const noexcept {
@@ -290,28 +311,91 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
-    return static_cast<size_t>(hash);
+    size_t hash = state.Hash();
+    Common::HashCombine(hash, Common::CityHash64(reinterpret_cast<const char*>(&unique_hashes),
+                                                 sizeof(unique_hashes)));
+    return hash;
+}
+
+size_t GraphicsPipelineCacheKey::Hash(
+    std::span<const u64, FixedPipelineState::NumHashGroups> state_group_hashes) const noexcept {
+    size_t hash = state.Hash(state_group_hashes);
+    Common::HashCombine(hash, Common::CityHash64(reinterpret_cast<const char*>(&unique_hashes),
+                                                 sizeof(unique_hashes)));
+    return hash;
 }
 
 bool GraphicsPipelineCacheKey::operator==(const GraphicsPipelineCacheKey& rhs) const noexcept {
     return std::memcmp(&rhs, this, Size()) == 0;
 }
 
+GraphicsPipeline* GraphicsPipelineTable::Find(const GraphicsPipelineCacheKey& key,
+                                               size_t hash) const noexcept {
+    if (entries.empty()) {
+        return nullptr;
+    }
+    const size_t mask = entries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask) {
+        const Entry& entry = entries[index];
+        if (!entry.pipeline) {
+            return nullptr;
+        }
+        if (entry.hash == hash && entry.pipeline->Key() == key) {
+            return entry.pipeline;
+        }
+    }
+}
+
+void GraphicsPipelineTable::Insert(size_t hash, GraphicsPipeline* pipeline) {
+    // Keep the load factor at or below one half so probe sequences stay short
+    if ((num_entries + 1) * 2 > entries.size()) {
+        Grow();
+    }
+    const size_t mask = entries.size() - 1;
+    size_t index = hash & mask;
+    while (entries[index].pipeline) {
+        index = (index + 1) & mask;
+    }
+    entries[index] = Entry{
+        .hash = hash,
+        .pipeline = pipeline,
+    };
+    ++num_entries;
+}
+
+void GraphicsPipelineTable::Grow() {
+    static constexpr size_t INITIAL_CAPACITY = 256;
+    const size_t new_capacity = entries.empty() ? INITIAL_CAPACITY : entries.size() * 2;
+    std::vector<Entry> old_entries = std::exchange(entries, std::vector<Entry>(new_capacity));
+    num_entries = 0;
+    for (const Entry& entry : old_entries) {
+        if (entry.pipeline) {
+            Insert(entry.hash, entry.pipeline);
+        }
+    }
+}
+
 PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
                              const Device& device_, Scheduler& scheduler_,
                              DescriptorPool& descriptor_pool_,
                              GuestDescriptorQueue& guest_descriptor_queue_,
+                             DescriptorBufferRing& descriptor_buffer_ring_,
                              RenderPassCache& render_pass_cache_, BufferCache& buffer_cache_,
                              TextureCache& texture_cache_, VideoCore::ShaderNotify& shader_notify_)
     : VideoCommon::ShaderCache{device_memory_}, device{device_}, scheduler{scheduler_},
       descriptor_pool{descriptor_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
-      render_pass_cache{render_pass_cache_}, buffer_cache{buffer_cache_},
-      texture_cache{texture_cache_}, shader_notify{shader_notify_},
+      descriptor_buffer_ring{descriptor_buffer_ring_}, render_pass_cache{render_pass_cache_},
+      buffer_cache{buffer_cache_}, texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
+      library_cache(device, vulkan_pipeline_cache), shader_object_cache(device),
       workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
               "VkPipelineBuilder"),
+      stage_workers(device.HasBrokenParallelShaderCompiling()
+                        ? 1ULL
+                        : std::min<size_t>(Maxwell::MaxShaderStage, GetTotalPipelineWorkers()),
+                    "VkShaderStageBuilder"),
+      optimize_workers(1, "VkPipelineOptimizer"),
       serialization_thread(1, "VkPipelineSerialization") {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
@@ -409,6 +493,10 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_extended_dynamic_state_3_enables = device.IsExtExtendedDynamicState3EnablesSupported(),
         .has_dynamic_vertex_input = device.IsExtVertexInputDynamicStateSupported(),
     };
+    for (size_t group = 0; group < FixedPipelineState::NumHashGroups; ++group) {
+        graphics_key_group_hashes[group] =
+            graphics_key.state.GroupHash(static_cast<FixedPipelineState::HashGroup>(group));
+    }
 }
 
 PipelineCache::~PipelineCache() {
@@ -422,17 +510,22 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
     MICROPROFILE_SCOPE(Vulkan_PipelineCache);
 
     if (!RefreshStages(graphics_key.unique_hashes)) {
-        current_pipeline = nullptr;
         return nullptr;
     }
-    graphics_key.state.Refresh(*maxwell3d, dynamic_features);
+    const u32 refreshed_groups{graphics_key.state.Refresh(*maxwell3d, dynamic_features)};
+    if (device.IsExtShaderObjectSupported()) {
+        // Only touches the header group, which is rehashed on every refresh
+        ClearShaderObjectDynamicState(graphics_key.state);
+    }
+    for (u32 groups = refreshed_groups; groups != 0; groups &= groups - 1) {
+        const auto group{static_cast<FixedPipelineState::HashGroup>(std::countr_zero(groups))};
+        graphics_key_group_hashes[group] = graphics_key.state.GroupHash(group);
+    }
+    graphics_key_hash = graphics_key.Hash(graphics_key_group_hashes);
 
-    if (current_pipeline) {
-        GraphicsPipeline* const next{current_pipeline->Next(graphics_key)};
-        if (next) {
-            current_pipeline = next;
-            return BuiltPipeline(current_pipeline);
-        }
+    GraphicsPipeline* const pipeline{graphics_table.Find(graphics_key, graphics_key_hash)};
+    if (pipeline) {
+        return BuiltPipeline(pipeline);
     }
     return CurrentGraphicsPipelineSlowPath();
 }
@@ -535,6 +628,7 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
 
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
+                graphics_table.Insert(key.Hash(), pipeline.get());
                 graphics_cache.emplace(key, std::move(pipeline));
             }
             ++state.built;
@@ -571,15 +665,14 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     auto& pipeline{pair->second};
     if (is_new) {
         pipeline = CreateGraphicsPipeline();
+        if (pipeline) {
+            graphics_table.Insert(graphics_key_hash, pipeline.get());
+        }
     }
     if (!pipeline) {
         return nullptr;
     }
-    if (current_pipeline) {
-        current_pipeline->AddTransition(pipeline.get());
-    }
-    current_pipeline = pipeline.get();
-    return BuiltPipeline(current_pipeline);
+    return BuiltPipeline(pipeline.get());
 }
 
 GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const noexcept {
@@ -610,11 +703,66 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     bool build_in_parallel) try {
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
+    std::array<Shader::Environment*, Maxwell::MaxShaderProgram> stage_envs{};
     size_t env_index{0};
+    for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+        if (key.unique_hashes[index] != 0) {
+            stage_envs[index] = envs[env_index];
+            ++env_index;
+        }
+    }
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
     const bool uses_vertex_a{key.unique_hashes[0] != 0};
     const bool uses_vertex_b{key.unique_hashes[1] != 0};
 
+    // Pipelines requested on the GPU thread translate and emit their stages in parallel, this is
+    // the latency perceived as a stutter. Stages are independent until they are linked.
+    const bool parallel_stages{build_in_parallel};
+    const auto run_stages{[&](auto&& func) {
+        if (!parallel_stages) {
+            for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+                func(index);
+            }
+            return;
+        }
+        std::array<std::exception_ptr, Maxwell::MaxShaderProgram> exceptions{};
+        for (size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
+            stage_workers.QueueWork([&func, &exceptions, index] {
+                try {
+                    func(index);
+                } catch (...) {
+                    exceptions[index] = std::current_exception();
+                }
+            });
+        }
+        stage_workers.WaitForRequests();
+        for (const std::exception_ptr& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }};
+
+    run_stages([&](size_t index) {
+        if (key.unique_hashes[index] == 0) {
+            return;
+        }
+        ShaderPools& stage_pool{parallel_stages ? stage_pools[index] : pools};
+        Shader::Environment& env{*stage_envs[index]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        Shader::Maxwell::Flow::CFG cfg(env, stage_pool.flow_block, cfg_offset, index == 0);
+        programs[index] = TranslateProgram(stage_pool.inst, stage_pool.block, env, cfg, host_info);
+
+        if (Settings::values.dump_shaders) {
+            env.Dump(hash, key.unique_hashes[index]);
+        }
+    });
+    if (uses_vertex_a && uses_vertex_b) {
+        // VertexB path when VertexA is present.
+        Shader::IR::Program program_vb{std::move(programs[1])};
+        programs[1] = MergeDualVertexPrograms(programs[0], program_vb, *stage_envs[1]);
+    }
+
     // Layer passthrough generation for devices without VK_EXT_shader_viewport_index_layer
     Shader::IR::Program* layer_source_program{};
 
@@ -630,39 +778,31 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         if (key.unique_hashes[index] == 0) {
             continue;
         }
-        Shader::Environment& env{*envs[env_index]};
-        ++env_index;
-
-        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
-        Shader::Maxwell::Flow::CFG cfg(env, pools.flow_block, cfg_offset, index == 0);
-        if (!uses_vertex_a || index != 1) {
-            // Normal path
-            programs[index] = TranslateProgram(pools.inst, pools.block, env, cfg, host_info);
-        } else {
-            // VertexB path when VertexA is present.
-            auto& program_va{programs[0]};
-            auto program_vb{TranslateProgram(pools.inst, pools.block, env, cfg, host_info)};
-            programs[index] = MergeDualVertexPrograms(program_va, program_vb, env);
-        }
-
-        if (Settings::values.dump_shaders) {
-            env.Dump(hash, key.unique_hashes[index]);
-        }
-
         if (programs[index].info.requires_layer_emulation) {
             layer_source_program = &programs[index];
         }
     }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
+    std::array<Shader::RuntimeInfo, Maxwell::MaxShaderStage> runtime_infos{};
+    std::array<Shader::Backend::Bindings, Maxwell::MaxShaderStage> stage_bindings{};
     std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
-
-    const Shader::IR::Program* previous_stage{};
-    Shader::Backend::Bindings binding;
-    for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0; index < Maxwell::MaxShaderProgram;
-         ++index) {
+    std::array<std::vector<u32>, Maxwell::MaxShaderStage> stage_code;
+    const bool use_shader_objects{device.IsExtShaderObjectSupported()};
+    // Pipelines loaded from disk are built before the game runs, where linking libraries first
+    // would only compile every pipeline twice
+    const bool fast_link{build_in_parallel && device.IsExtGraphicsPipelineLibrarySupported()};
+
+    // Linking varyings and assigning bindings has to be done in stage order
+    const size_t first_stage{uses_vertex_a && uses_vertex_b ? 1ULL : 0ULL};
+    const auto uses_stage{[&](size_t index) {
         const bool is_emulated_stage = layer_source_program != nullptr &&
                                        index == static_cast<u32>(Maxwell::ShaderType::Geometry);
-        if (key.unique_hashes[index] == 0 && !is_emulated_stage) {
+        return index >= first_stage && (key.unique_hashes[index] != 0 || is_emulated_stage);
+    }};
+    const Shader::IR::Program* previous_stage{};
+    Shader::Backend::Bindings binding;
+    for (size_t index = first_stage; index < Maxwell::MaxShaderProgram; ++index) {
+        if (!uses_stage(index)) {
             continue;
         }
         UNIMPLEMENTED_IF(index == 0);
@@ -671,22 +811,45 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         const size_t stage_index{index - 1};
         infos[stage_index] = &program.info;
 
-        const auto runtime_info{MakeRuntimeInfo(programs, key, program, previous_stage)};
-        ConvertLegacyToGeneric(program, runtime_info);
-        const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding)};
+        runtime_infos[stage_index] = MakeRuntimeInfo(programs, key, program, previous_stage);
+        ConvertLegacyToGeneric(program, runtime_infos[stage_index]);
+        stage_bindings[stage_index] = binding;
+        AssignBindings(profile, program.info, binding);
+        previous_stage = &program;
+    }
+    run_stages([&](size_t index) {
+        if (!uses_stage(index) || index == 0) {
+            return;
+        }
+        Shader::IR::Program& program{programs[index]};
+        const size_t stage_index{index - 1};
+        std::vector<u32> code{EmitSPIRV(profile, runtime_infos[stage_index], program,
+                                        stage_bindings[stage_index])};
         device.SaveShader(code);
+        if (use_shader_objects) {
+            // Shader objects are created from the code once the descriptor layout is known
+            stage_code[stage_index] = std::move(code);
+            return;
+        }
         modules[stage_index] = BuildShader(device, code);
         if (device.HasDebuggingToolAttached()) {
             const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
             modules[stage_index].SetObjectNameEXT(name.c_str());
         }
-        previous_stage = &program;
-    }
+        if (fast_link) {
+            // Pipeline library parts are shared between pipelines with the same code
+            stage_code[stage_index] = std::move(code);
+        }
+    });
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        descriptor_pool, guest_descriptor_queue,
+        device.IsExtDescriptorBufferSupported() ? &descriptor_buffer_ring : nullptr, thread_worker,
+        statistics, render_pass_cache, fast_link ? &library_cache : nullptr,
+        fast_link ? &optimize_workers : nullptr,
+        use_shader_objects ? &shader_object_cache : nullptr, key, std::move(modules),
+        std::move(stage_code), infos);
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -711,6 +874,9 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
 
     main_pools.ReleaseContents();
+    for (ShaderPools& pools : stage_pools) {
+        pools.ReleaseContents();
+    }
     auto pipeline{
         CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(), nullptr, true)};
     if (!pipeline || pipeline_cache_filename.empty()) {
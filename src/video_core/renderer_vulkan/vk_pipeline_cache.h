@@ -97,11 +97,34 @@ struct ShaderPools {
     Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
 };
 
+/// Flat open addressing table used to look up graphics pipelines by key on every draw
+class GraphicsPipelineTable {
+public:
+    /// Returns the pipeline with the given key and key hash, or null when it is not in the table
+    [[nodiscard]] GraphicsPipeline* Find(const GraphicsPipelineCacheKey& key,
+                                         size_t hash) const noexcept;
+
+    /// Inserts a pipeline that is not in the table yet
+    void Insert(size_t hash, GraphicsPipeline* pipeline);
+
+private:
+    struct Entry {
+        size_t hash;
+        GraphicsPipeline* pipeline;
+    };
+
+    void Grow();
+
+    std::vector<Entry> entries;
+    size_t num_entries{};
+};
+
 class PipelineCache : public VideoCommon::ShaderCache {
 public:
     explicit PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, const Device& device,
                            Scheduler& scheduler, DescriptorPool& descriptor_pool,
                            GuestDescriptorQueue& guest_descriptor_queue,
+                           DescriptorBufferRing& descriptor_buffer_ring,
                            RenderPassCache& render_pass_cache, BufferCache& buffer_cache,
                            TextureCache& texture_cache, VideoCore::ShaderNotify& shader_notify_);
     ~PipelineCache();
@@ -144,6 +167,7 @@ private:
     Scheduler& scheduler;
     DescriptorPool& descriptor_pool;
     GuestDescriptorQueue& guest_descriptor_queue;
+    DescriptorBufferRing& descriptor_buffer_ring;
     RenderPassCache& render_pass_cache;
     BufferCache& buffer_cache;
     TextureCache& texture_cache;
@@ -152,12 +176,15 @@ private:
     bool use_vulkan_pipeline_cache{};
 
     GraphicsPipelineCacheKey graphics_key{};
-    GraphicsPipeline* current_pipeline{};
+    std::array<u64, FixedPipelineState::NumHashGroups> graphics_key_group_hashes{};
+    size_t graphics_key_hash{};
 
     std::unordered_map<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>> compute_cache;
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
+    GraphicsPipelineTable graphics_table;
 
     ShaderPools main_pools;
+    std::array<ShaderPools, Maxwell::MaxShaderProgram> stage_pools;
 
     Shader::Profile profile;
     Shader::HostTranslateInfo host_info;
@@ -166,8 +193,12 @@ private:
 
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
+    GraphicsPipelineLibraryCache library_cache;
+    ShaderObjectCache shader_object_cache;
 
     Common::ThreadWorker workers;
+    Common::ThreadWorker stage_workers;
+    Common::ThreadWorker optimize_workers;
     Common::ThreadWorker serialization_thread;
     DynamicFeatures dynamic_features;
 };
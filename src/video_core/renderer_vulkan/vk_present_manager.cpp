@@ -1,10 +1,14 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "common/thread.h"
 #include "core/frontend/emu_window.h"
+#include "video_core/gpu.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_swapchain.h"
@@ -15,9 +19,20 @@ namespace Vulkan {
 
 MICROPROFILE_DEFINE(Vulkan_WaitPresent, "Vulkan", "Wait For Present", MP_RGB(128, 128, 128));
 MICROPROFILE_DEFINE(Vulkan_CopyToSwapchain, "Vulkan", "Copy to swapchain", MP_RGB(192, 255, 192));
+MICROPROFILE_DEFINE(Vulkan_PaceFrame, "Vulkan", "Pace frame", MP_RGB(128, 192, 255));
 
 namespace {
 
+// Bounds of the number of frames allowed to be queued for display in low latency mode
+constexpr u32 MIN_FRAMES_AHEAD = 1;
+constexpr u32 MAX_FRAMES_AHEAD = 3;
+
+// Consecutive throttled frames without the display starving before a frame less is queued
+constexpr u32 THROTTLED_FRAMES_TO_SHRINK = 300;
+
+// Maximum time to wait for the display, frames may never be shown when the window is hidden
+constexpr u64 PRESENT_WAIT_TIMEOUT_NS = 100'000'000;
+
 bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat format) {
     const VkFormatProperties props{physical_device.GetFormatProperties(format)};
     return (props.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
@@ -97,12 +112,14 @@ bool CanBlitToSwapchain(const vk::PhysicalDevice& physical_device, VkFormat form
 PresentManager::PresentManager(const vk::Instance& instance_,
                                Core::Frontend::EmuWindow& render_window_, const Device& device_,
                                MemoryAllocator& memory_allocator_, Scheduler& scheduler_,
-                               Swapchain& swapchain_, vk::SurfaceKHR& surface_)
+                               Swapchain& swapchain_, vk::SurfaceKHR& surface_, Tegra::GPU& gpu_)
     : instance{instance_}, render_window{render_window_}, device{device_},
       memory_allocator{memory_allocator_}, scheduler{scheduler_}, swapchain{swapchain_},
-      surface{surface_}, blit_supported{CanBlitToSwapchain(device.GetPhysical(),
-                                                           swapchain.GetImageViewFormat())},
-      use_present_thread{Settings::values.async_presentation.GetValue()} {
+      surface{surface_}, gpu{gpu_}, blit_supported{CanBlitToSwapchain(
+                                        device.GetPhysical(), swapchain.GetImageViewFormat())},
+      use_present_thread{Settings::values.async_presentation.GetValue()},
+      low_latency{Settings::values.low_latency_presentation.GetValue()},
+      use_present_wait{low_latency && device.IsKhrPresentWaitSupported()} {
     SetImageCount();
 
     auto& dld = device.GetLogical();
@@ -132,6 +149,11 @@ PresentManager::PresentManager(const vk::Instance& instance_,
         free_queue.push(&frame);
     }
 
+    if (low_latency) {
+        LOG_INFO(Render_Vulkan, "Low latency frame pacing enabled, using {}",
+                 use_present_wait ? "VK_KHR_present_wait" : "presentation fences");
+    }
+
     if (use_present_thread) {
         present_thread = std::jthread([this](std::stop_token token) { PresentThread(token); });
     }
@@ -142,9 +164,9 @@ PresentManager::~PresentManager() = default;
 Frame* PresentManager::GetRenderFrame() {
     MICROPROFILE_SCOPE(Vulkan_WaitPresent);
 
-    // Wait for free presentation frames
+    // Wait for free presentation frames, and for the display to catch up in low latency mode
     std::unique_lock lock{free_mutex};
-    free_cv.wait(lock, [this] { return !free_queue.empty(); });
+    free_cv.wait(lock, [this] { return !free_queue.empty() && !IsRunningAhead(); });
 
     // Take the frame from the queue
     Frame* frame = free_queue.front();
@@ -158,6 +180,11 @@ Frame* PresentManager::GetRenderFrame() {
 }
 
 void PresentManager::Present(Frame* frame) {
+    if (low_latency) {
+        frame->present_id = ++present_count;
+        frame->queue_time = std::chrono::steady_clock::now();
+    }
+
     if (!use_present_thread) {
         scheduler.WaitWorker();
         CopyToSwapchain(frame);
@@ -290,6 +317,10 @@ void PresentManager::PresentThread(std::stop_token token) {
 void PresentManager::RecreateSwapchain(Frame* frame) {
     swapchain.Create(*surface, frame->width, frame->height);
     SetImageCount();
+
+    // Present ids of the old swapchain can't be waited on anymore, this frame is the first one
+    // presented on the new swapchain
+    swapchain_base_id = frame->present_id - 1;
 }
 
 void PresentManager::SetImageCount() {
@@ -311,7 +342,11 @@ void PresentManager::CopyToSwapchain(Frame* frame) {
             }
 
             // Draw to swapchain.
-            return CopyToSwapchainImpl(frame);
+            CopyToSwapchainImpl(frame);
+            if (low_latency) {
+                PaceFrame(frame);
+            }
+            return;
         } catch (const vk::Exception& except) {
             if (except.GetResult() != VK_ERROR_SURFACE_LOST_KHR) {
                 throw;
@@ -482,7 +517,71 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
     }
 
     // Present
-    swapchain.Present(render_semaphore);
+    swapchain.Present(render_semaphore, frame->present_id);
+}
+
+void PresentManager::PaceFrame(Frame* frame) {
+    MICROPROFILE_SCOPE(Vulkan_PaceFrame);
+
+    const u64 present_id{frame->present_id};
+    pending_frames.emplace_back(present_id, frame->queue_time);
+
+    if (!use_present_wait) {
+        // Without present wait the best estimate of the display time is the completion of the
+        // copy to the swapchain image, keep a single frame queued on top of it.
+        const bool signaled{frame->present_done.Wait(PRESENT_WAIT_TIMEOUT_NS) == VK_SUCCESS};
+        MarkDisplayed(present_id, signaled);
+        return;
+    }
+
+    // If the previous frame is already on screen the display queue ran dry. When that happens
+    // while we were holding rendering back, the limit is too tight and causes stutter.
+    const u64 previous_id{present_id - 1};
+    const bool starved{previous_id > swapchain_base_id && swapchain.WaitForPresent(previous_id, 0)};
+    if (starved && previous_throttled) {
+        frames_ahead = std::min(frames_ahead + 1, MAX_FRAMES_AHEAD);
+        throttled_streak = 0;
+    }
+
+    // Wait until only frames_ahead frames are queued for display
+    const u64 target_id{present_id > frames_ahead ? present_id - frames_ahead : 0};
+    if (target_id <= swapchain_base_id) {
+        // The target frame belongs to an older swapchain, there is nothing to wait for
+        previous_throttled = false;
+        MarkDisplayed(target_id, false);
+        return;
+    }
+    bool displayed{swapchain.WaitForPresent(target_id, 0)};
+    previous_throttled = !displayed;
+    if (!displayed) {
+        displayed = swapchain.WaitForPresent(target_id, PRESENT_WAIT_TIMEOUT_NS);
+        if (!starved && ++throttled_streak >= THROTTLED_FRAMES_TO_SHRINK) {
+            // The display has been consistently fed, try to shave off a frame of latency
+            frames_ahead = std::max(frames_ahead - 1, MIN_FRAMES_AHEAD);
+            throttled_streak = 0;
+        }
+    }
+    MarkDisplayed(target_id, displayed);
+}
+
+void PresentManager::MarkDisplayed(u64 present_id, bool measured) {
+    const auto now{std::chrono::steady_clock::now()};
+    while (!pending_frames.empty() && pending_frames.front().first <= present_id) {
+        if (measured) {
+            gpu.RendererPresentLatencyNotify(now - pending_frames.front().second);
+        }
+        pending_frames.pop_front();
+    }
+
+    std::scoped_lock lock{free_mutex};
+    displayed_id = std::max(displayed_id, present_id);
+    allowed_ahead = frames_ahead;
+    free_cv.notify_one();
+}
+
+bool PresentManager::IsRunningAhead() const {
+    // Allow one frame to be rendered while frames_ahead frames are queued for display
+    return low_latency && present_count > displayed_id + allowed_ahead + 1;
 }
 
 } // namespace Vulkan
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
+#include <utility>
 
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
@@ -16,6 +19,10 @@ namespace Core::Frontend {
 class EmuWindow;
 } // namespace Core::Frontend
 
+namespace Tegra {
+class GPU;
+}
+
 namespace Vulkan {
 
 class Device;
@@ -31,13 +38,15 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    u64 present_id{};
+    std::chrono::steady_clock::time_point queue_time{};
 };
 
 class PresentManager {
 public:
     PresentManager(const vk::Instance& instance, Core::Frontend::EmuWindow& render_window,
                    const Device& device, MemoryAllocator& memory_allocator, Scheduler& scheduler,
-                   Swapchain& swapchain, vk::SurfaceKHR& surface);
+                   Swapchain& swapchain, vk::SurfaceKHR& surface, Tegra::GPU& gpu);
     ~PresentManager();
 
     /// Returns the last used presentation frame
@@ -60,6 +69,16 @@ private:
 
     void CopyToSwapchainImpl(Frame* frame);
 
+    /// Blocks until the display has caught up with the presented frame and adapts how many
+    /// frames are allowed to be queued ahead of it
+    void PaceFrame(Frame* frame);
+
+    /// Marks every frame up to the given present id as displayed
+    void MarkDisplayed(u64 present_id, bool measured);
+
+    /// Returns true when the renderer has to wait for the display before starting a new frame
+    bool IsRunningAhead() const;
+
     void RecreateSwapchain(Frame* frame);
 
     void SetImageCount();
@@ -72,6 +91,7 @@ private:
     Scheduler& scheduler;
     Swapchain& swapchain;
     vk::SurfaceKHR& surface;
+    Tegra::GPU& gpu;
     vk::CommandPool cmdpool;
     std::vector<Frame> frames;
     std::queue<Frame*> present_queue;
@@ -85,6 +105,17 @@ private:
     bool blit_supported;
     bool use_present_thread;
     std::size_t image_count{};
+
+    bool low_latency;                ///< Limits how far rendering may run ahead of the display
+    bool use_present_wait;           ///< Uses VK_KHR_present_wait to know when frames are shown
+    u64 present_count{};             ///< Number of frames pushed for presentation
+    u64 displayed_id{};              ///< Present id of the last frame known to be displayed
+    u32 allowed_ahead{1};            ///< Copy of frames_ahead read by the rendering thread
+    u64 swapchain_base_id{};         ///< Present id of the last frame of the previous swapchain
+    u32 frames_ahead{1};             ///< Frames allowed to be queued for display
+    u32 throttled_streak{};          ///< Consecutive frames that had to wait for the display
+    bool previous_throttled{};       ///< Whether the previous frame had to wait for the display
+    std::deque<std::pair<u64, std::chrono::steady_clock::time_point>> pending_frames;
 };
 
 } // namespace Vulkan
@@ -183,19 +183,22 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
       memory_allocator{memory_allocator_}, state_tracker{state_tracker_}, scheduler{scheduler_},
       staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, scheduler),
       guest_descriptor_queue(device, scheduler), compute_pass_descriptor_queue(device, scheduler),
+      descriptor_buffer_ring(device, memory_allocator, scheduler),
       blit_image(device, scheduler, state_tracker, descriptor_pool), render_pass_cache(device),
       texture_cache_runtime{
           device,     scheduler,         memory_allocator, staging_pool,
           blit_image, render_pass_cache, descriptor_pool,  compute_pass_descriptor_queue},
       texture_cache(texture_cache_runtime, device_memory),
       buffer_cache_runtime(device, memory_allocator, scheduler, staging_pool,
-                           guest_descriptor_queue, compute_pass_descriptor_queue, descriptor_pool),
+                           guest_descriptor_queue, compute_pass_descriptor_queue, descriptor_pool,
+                           device_memory),
       buffer_cache(device_memory, buffer_cache_runtime),
       query_cache_runtime(this, device_memory, buffer_cache, device, memory_allocator, scheduler,
                           staging_pool, compute_pass_descriptor_queue, descriptor_pool),
       query_cache(gpu, *this, device_memory, query_cache_runtime),
       pipeline_cache(device_memory, device, scheduler, descriptor_pool, guest_descriptor_queue,
-                     render_pass_cache, buffer_cache, texture_cache, gpu.ShaderNotify()),
+                     descriptor_buffer_ring, render_pass_cache, buffer_cache, texture_cache,
+                     gpu.ShaderNotify()),
       accelerate_dma(buffer_cache, texture_cache, scheduler),
       fence_manager(*this, gpu, texture_cache, buffer_cache, query_cache, device, scheduler),
       wfi_event(device.GetLogical().CreateEvent()) {
@@ -226,6 +229,9 @@ void RasterizerVulkan::PrepareDraw(bool is_indexed, Func&& draw_func) {
     pipeline->Configure(is_indexed);
 
     UpdateDynamicStates();
+    if (pipeline->UsesShaderObjects()) {
+        UpdateShaderObjectState(*pipeline);
+    }
 
     HandleTransformFeedback();
     query_cache.CounterEnable(VideoCommon::QueryType::ZPassPixelCount64,
@@ -680,7 +686,7 @@ void RasterizerVulkan::UnmapMemory(DAddr addr, u64 size) {
     }
     {
         std::scoped_lock lock{buffer_cache.mutex};
-        buffer_cache.WriteMemory(addr, size);
+        buffer_cache.UnmapMemory(addr, size);
     }
     pipeline_cache.OnCacheInvalidation(addr, size);
 }
@@ -857,8 +863,8 @@ void RasterizerVulkan::FlushWork() {
         return;
     }
     if (draw_counter < DRAWS_TO_DISPATCH) {
-        // Send recorded tasks to the worker thread
-        scheduler.DispatchWork();
+        // Send recorded tasks to the worker threads
+        scheduler.DispatchWorkAtDrawBoundary();
         return;
     }
     // Otherwise (every certain number of draws) flush execution.
@@ -968,6 +974,86 @@ void RasterizerVulkan::UpdateDynamicStates() {
     }
 }
 
+void RasterizerVulkan::UpdateShaderObjectState(const GraphicsPipeline& pipeline) {
+    const auto& regs = maxwell3d->regs;
+    const auto topology = maxwell3d->draw_manager->GetDrawState().topology;
+    ShaderObjectState state{
+        .topology = MaxwellToVK::PrimitiveTopology(device, topology),
+        .patch_control_points = regs.patch_vertices,
+        .polygon_mode = MaxwellToVK::PolygonMode(regs.polygon_mode_front),
+        .samples = MaxwellToVK::MsaaMode(regs.anti_alias_samples_mode),
+        .provoking_vertex = regs.provoking_vertex == Maxwell::ProvokingVertex::Last
+                                ? VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT
+                                : VK_PROVOKING_VERTEX_MODE_FIRST_VERTEX_EXT,
+        .line_mode = regs.line_anti_alias_enable != 0
+                         ? VK_LINE_RASTERIZATION_MODE_RECTANGULAR_SMOOTH_EXT
+                         : VK_LINE_RASTERIZATION_MODE_RECTANGULAR_EXT,
+        .conservative_mode = regs.conservative_raster_enable != 0
+                                 ? VK_CONSERVATIVE_RASTERIZATION_MODE_OVERESTIMATE_EXT
+                                 : VK_CONSERVATIVE_RASTERIZATION_MODE_DISABLED_EXT,
+        .alpha_to_coverage = regs.anti_alias_alpha_control.alpha_to_coverage != 0,
+        .alpha_to_one = regs.anti_alias_alpha_control.alpha_to_one != 0,
+        .negative_one_to_one = regs.depth_mode == Maxwell::DepthMode::MinusOneToOne,
+        .swizzles{},
+    };
+    // Same topology fixups as the ones applied when building pipelines
+    if (state.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST && !pipeline.HasTessellationStages()) {
+        state.topology = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+    } else if (pipeline.HasTessellationStages()) {
+        state.topology = VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
+    }
+    for (size_t index = 0; index < Maxwell::NumViewports; ++index) {
+        state.swizzles[index] = regs.viewport_transform[index].swizzle.raw;
+    }
+    if (!state_tracker.TouchShaderObjectState() && state == shader_object_state) {
+        return;
+    }
+    shader_object_state = state;
+    scheduler.Record([this, state](vk::CommandBuffer cmdbuf) {
+        cmdbuf.SetPrimitiveTopologyEXT(state.topology);
+        cmdbuf.SetPatchControlPointsEXT(state.patch_control_points);
+        cmdbuf.SetPolygonModeEXT(state.polygon_mode);
+        cmdbuf.SetRasterizationSamplesEXT(state.samples);
+        static constexpr VkSampleMask sample_mask{0xffffffff};
+        cmdbuf.SetSampleMaskEXT(state.samples, &sample_mask);
+        cmdbuf.SetAlphaToCoverageEnableEXT(state.alpha_to_coverage);
+        cmdbuf.SetAlphaToOneEnableEXT(state.alpha_to_one);
+        cmdbuf.SetTessellationDomainOriginEXT(VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT);
+        if (device.IsExtProvokingVertexSupported()) {
+            cmdbuf.SetProvokingVertexModeEXT(state.provoking_vertex);
+        }
+        if (device.IsExtLineRasterizationSupported()) {
+            cmdbuf.SetLineRasterizationModeEXT(state.line_mode);
+            cmdbuf.SetLineStippleEnableEXT(false);
+        }
+        if (device.IsExtConservativeRasterizationSupported()) {
+            cmdbuf.SetConservativeRasterizationModeEXT(state.conservative_mode);
+            cmdbuf.SetExtraPrimitiveOverestimationSizeEXT(0.0f);
+        }
+        if (device.IsExtDepthClipControlSupported()) {
+            cmdbuf.SetDepthClipNegativeOneToOneEXT(state.negative_one_to_one);
+        }
+        if (device.IsNvViewportSwizzleSupported()) {
+            using Swizzle = decltype(Maxwell::ViewportTransform::swizzle);
+            std::array<VkViewportSwizzleNV, Maxwell::NumViewports> swizzles;
+            for (size_t index = 0; index < Maxwell::NumViewports; ++index) {
+                Swizzle swizzle;
+                swizzle.raw = state.swizzles[index];
+                swizzles[index] = VkViewportSwizzleNV{
+                    .x = MaxwellToVK::ViewportSwizzle(swizzle.x),
+                    .y = MaxwellToVK::ViewportSwizzle(swizzle.y),
+                    .z = MaxwellToVK::ViewportSwizzle(swizzle.z),
+                    .w = MaxwellToVK::ViewportSwizzle(swizzle.w),
+                };
+            }
+            cmdbuf.SetViewportSwizzleNV(0, swizzles);
+        }
+        if (device.IsExtTransformFeedbackSupported()) {
+            cmdbuf.SetRasterizationStreamEXT(0);
+        }
+    });
+}
+
 void RasterizerVulkan::HandleTransformFeedback() {
     static std::once_flag warn_unsupported;
 
@@ -1003,6 +1089,18 @@ void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D::Regs& reg
             .minDepth = 0.0f,
             .maxDepth = 1.0f,
         };
+        if (device.IsExtShaderObjectSupported()) {
+            // The viewport count is dynamic with shader objects, keep it matching the scissors
+            std::array<VkViewport, Maxwell::NumViewports> viewport_list;
+            viewport_list.fill(viewport);
+            scheduler.Record([this, viewport_list](vk::CommandBuffer cmdbuf) {
+                const u32 num_viewports =
+                    std::min<u32>(device.GetMaxViewports(), Maxwell::NumViewports);
+                cmdbuf.SetViewportWithCountEXT(
+                    vk::Span<VkViewport>(viewport_list.data(), num_viewports));
+            });
+            return;
+        }
         scheduler.Record([viewport](vk::CommandBuffer cmdbuf) { cmdbuf.SetViewport(0, viewport); });
         return;
     }
@@ -1021,7 +1119,11 @@ void RasterizerVulkan::UpdateViewportsState(Tegra::Engines::Maxwell3D::Regs& reg
     scheduler.Record([this, viewport_list](vk::CommandBuffer cmdbuf) {
         const u32 num_viewports = std::min<u32>(device.GetMaxViewports(), Maxwell::NumViewports);
         const vk::Span<VkViewport> viewports(viewport_list.data(), num_viewports);
-        cmdbuf.SetViewport(0, viewports);
+        if (device.IsExtShaderObjectSupported()) {
+            cmdbuf.SetViewportWithCountEXT(viewports);
+        } else {
+            cmdbuf.SetViewport(0, viewports);
+        }
     });
 }
 
@@ -1039,6 +1141,17 @@ void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D::Regs& regs
         scissor.offset.y = static_cast<u32>(y);
         scissor.extent.width = static_cast<u32>(width != 0.0f ? width : 1.0f);
         scissor.extent.height = static_cast<u32>(height != 0.0f ? height : 1.0f);
+        if (device.IsExtShaderObjectSupported()) {
+            std::array<VkRect2D, Maxwell::NumViewports> scissor_list;
+            scissor_list.fill(scissor);
+            scheduler.Record([this, scissor_list](vk::CommandBuffer cmdbuf) {
+                const u32 num_scissors =
+                    std::min<u32>(device.GetMaxViewports(), Maxwell::NumViewports);
+                cmdbuf.SetScissorWithCountEXT(
+                    vk::Span<VkRect2D>(scissor_list.data(), num_scissors));
+            });
+            return;
+        }
         scheduler.Record([scissor](vk::CommandBuffer cmdbuf) { cmdbuf.SetScissor(0, scissor); });
         return;
     }
@@ -1069,7 +1182,11 @@ void RasterizerVulkan::UpdateScissorsState(Tegra::Engines::Maxwell3D::Regs& regs
     scheduler.Record([this, scissor_list](vk::CommandBuffer cmdbuf) {
         const u32 num_scissors = std::min<u32>(device.GetMaxViewports(), Maxwell::NumViewports);
         const vk::Span<VkRect2D> scissors(scissor_list.data(), num_scissors);
-        cmdbuf.SetScissor(0, scissors);
+        if (device.IsExtShaderObjectSupported()) {
+            cmdbuf.SetScissorWithCountEXT(scissors);
+        } else {
+            cmdbuf.SetScissor(0, scissors);
+        }
     });
 }
 
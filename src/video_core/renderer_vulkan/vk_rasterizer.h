@@ -14,6 +14,7 @@
 #include "video_core/rasterizer_interface.h"
 #include "video_core/renderer_vulkan/blit_image.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_fence_manager.h"
 #include "video_core/renderer_vulkan/vk_pipeline_cache.h"
@@ -180,6 +181,25 @@ private:
 
     void UpdateVertexInput(Tegra::Engines::Maxwell3D::Regs& regs);
 
+    void UpdateShaderObjectState(const GraphicsPipeline& pipeline);
+
+    /// Render state baked into pipelines that has to be set at draw time with shader objects
+    struct ShaderObjectState {
+        VkPrimitiveTopology topology;
+        u32 patch_control_points;
+        VkPolygonMode polygon_mode;
+        VkSampleCountFlagBits samples;
+        VkProvokingVertexModeEXT provoking_vertex;
+        VkLineRasterizationModeEXT line_mode;
+        VkConservativeRasterizationModeEXT conservative_mode;
+        bool alpha_to_coverage;
+        bool alpha_to_one;
+        bool negative_one_to_one;
+        std::array<u32, Tegra::Engines::Maxwell3D::Regs::NumViewports> swizzles;
+
+        bool operator==(const ShaderObjectState&) const = default;
+    };
+
     Tegra::GPU& gpu;
     Tegra::MaxwellDeviceMemoryManager& device_memory;
 
@@ -192,6 +212,7 @@ private:
     DescriptorPool descriptor_pool;
     GuestDescriptorQueue guest_descriptor_queue;
     ComputePassDescriptorQueue compute_pass_descriptor_queue;
+    DescriptorBufferRing descriptor_buffer_ring;
     BlitImageHelper blit_image;
     RenderPassCache render_pass_cache;
 
@@ -212,6 +233,7 @@ private:
     boost::container::static_vector<VkSampler, MAX_TEXTURES> sampler_handles;
 
     u32 draw_counter = 0;
+    ShaderObjectState shader_object_state{};
 };
 
 } // namespace Vulkan
@@ -32,6 +32,43 @@ VkAttachmentDescription AttachmentDescription(const Device& device, PixelFormat
 }
 } // Anonymous namespace
 
+PipelineRenderingInfo::PipelineRenderingInfo(const Device& device, const RenderPassKey& key) {
+    using MaxwellToVK::SurfaceFormat;
+    using VideoCore::Surface::SurfaceType;
+    u32 num_colors{};
+    for (size_t index = 0; index < key.color_formats.size(); ++index) {
+        const PixelFormat format{key.color_formats[index]};
+        if (format == PixelFormat::Invalid) {
+            color_formats[index] = VK_FORMAT_UNDEFINED;
+            continue;
+        }
+        color_formats[index] = SurfaceFormat(device, FormatType::Optimal, true, format).format;
+        num_colors = static_cast<u32>(index + 1);
+    }
+    VkFormat depth_format{VK_FORMAT_UNDEFINED};
+    VkFormat stencil_format{VK_FORMAT_UNDEFINED};
+    if (key.depth_format != PixelFormat::Invalid) {
+        const VkFormat format{
+            SurfaceFormat(device, FormatType::Optimal, true, key.depth_format).format};
+        const SurfaceType type{VideoCore::Surface::GetFormatType(key.depth_format)};
+        if (type == SurfaceType::Depth || type == SurfaceType::DepthStencil) {
+            depth_format = format;
+        }
+        if (type == SurfaceType::Stencil || type == SurfaceType::DepthStencil) {
+            stencil_format = format;
+        }
+    }
+    ci = VkPipelineRenderingCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext = nullptr,
+        .viewMask = 0,
+        .colorAttachmentCount = num_colors,
+        .pColorAttachmentFormats = color_formats.data(),
+        .depthAttachmentFormat = depth_format,
+        .stencilAttachmentFormat = stencil_format,
+    };
+}
+
 RenderPassCache::RenderPassCache(const Device& device_) : device{&device_} {}
 
 VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <mutex>
 #include <unordered_map>
 
@@ -12,7 +13,7 @@
 namespace Vulkan {
 
 struct RenderPassKey {
-    bool operator==(const RenderPassKey&) const noexcept = default;
+    auto operator<=>(const RenderPassKey&) const noexcept = default;
 
     std::array<VideoCore::Surface::PixelFormat, 8> color_formats;
     VideoCore::Surface::PixelFormat depth_format;
@@ -39,6 +40,18 @@ namespace Vulkan {
 
 class Device;
 
+/// Attachment formats chained into graphics pipelines in place of a render pass when render
+/// targets are bound with dynamic rendering (VK_KHR_dynamic_rendering).
+struct PipelineRenderingInfo {
+    explicit PipelineRenderingInfo(const Device& device, const RenderPassKey& key);
+
+    PipelineRenderingInfo(const PipelineRenderingInfo&) = delete;
+    PipelineRenderingInfo& operator=(const PipelineRenderingInfo&) = delete;
+
+    std::array<VkFormat, 8> color_formats{};
+    VkPipelineRenderingCreateInfo ci{};
+};
+
 class RenderPassCache {
 public:
     explicit RenderPassCache(const Device& device_);
@@ -1,14 +1,23 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <span>
+#include <string>
 #include <thread>
 #include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/assert.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
@@ -22,6 +31,20 @@ namespace Vulkan {
 
 MICROPROFILE_DECLARE(Vulkan_WaitForWorker);
 
+namespace {
+constexpr size_t MAX_RECORDERS = 4;
+
+// Minimum amount of command data before splitting a submission into another command buffer
+constexpr size_t MIN_SEGMENT_SIZE = 0x10000;
+
+size_t NumRecorders() {
+    if (!Settings::values.use_parallel_command_recording.GetValue()) {
+        return 1;
+    }
+    return std::clamp<size_t>(std::thread::hardware_concurrency() / 4, 2, MAX_RECORDERS);
+}
+} // Anonymous namespace
+
 void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
                                          vk::CommandBuffer upload_cmdbuf) {
     auto command = first;
@@ -31,7 +54,7 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
         command->~Command();
         command = next;
     }
-    submit = false;
+    ends_command_buffer = false;
     command_offset = 0;
     first = nullptr;
     last = nullptr;
@@ -39,14 +62,29 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 
 Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
     : device{device_}, state_tracker{state_tracker_},
-      master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      master_semaphore{std::make_unique<MasterSemaphore>(device)} {
     AcquireNewChunk();
-    AllocateWorkerCommandBuffer();
-    worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
+    const size_t num_recorders = NumRecorders();
+    recorders.reserve(num_recorders);
+    for (size_t index = 0; index < num_recorders; ++index) {
+        Recorder& recorder = *recorders.emplace_back(std::make_unique<Recorder>());
+        recorder.command_pool = std::make_unique<CommandPool>(*master_semaphore, device);
+        recorder.thread = std::jthread([this, &recorder, index](std::stop_token token) {
+            WorkerThread(token, recorder, index);
+        });
+    }
+    if (num_recorders > 1) {
+        LOG_INFO(Render_Vulkan, "Recording commands on {} threads", num_recorders);
+    }
 }
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler() {
+    // Recorders may be waiting for segments of other recorders, stop them all before joining
+    stop_source.request_stop();
+    for (const auto& recorder : recorders) {
+        recorder->thread.request_stop();
+    }
+}
 
 u64 Scheduler::Flush(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     // When flushing, we only send data to the worker thread; no waiting is necessary.
@@ -67,72 +105,59 @@ void Scheduler::WaitWorker() {
     MICROPROFILE_SCOPE(Vulkan_WaitForWorker);
     DispatchWork();
 
-    // Ensure the queue is drained.
-    {
-        std::unique_lock ql{queue_mutex};
-        event_cv.wait(ql, [this] { return work_queue.empty(); });
-    }
+    for (const auto& recorder : recorders) {
+        // Ensure the queue is drained.
+        {
+            std::unique_lock ql{recorder->queue_mutex};
+            recorder->event_cv.wait(ql, [&] { return recorder->work_queue.empty(); });
+        }
 
-    // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+        // Now wait for execution to finish.
+        std::scoped_lock el{recorder->execution_mutex};
+    }
 }
 
 void Scheduler::DispatchWork() {
     if (chunk->Empty()) {
         return;
     }
+    segment_size += chunk->Size();
+    Recorder& recorder = *recorders[current_recorder];
     {
-        std::scoped_lock ql{queue_mutex};
-        work_queue.push(std::move(chunk));
+        std::scoped_lock ql{recorder.queue_mutex};
+        recorder.work_queue.push(std::move(chunk));
     }
-    event_cv.notify_all();
+    recorder.event_cv.notify_all();
     AcquireNewChunk();
 }
 
-void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
-    const VkRenderPass renderpass = framebuffer->RenderPass();
-    const VkFramebuffer framebuffer_handle = framebuffer->Handle();
-    const VkExtent2D render_area = framebuffer->RenderArea();
-    if (renderpass == state.renderpass && framebuffer_handle == state.framebuffer &&
-        render_area.width == state.render_area.width &&
-        render_area.height == state.render_area.height) {
+void Scheduler::DispatchWorkAtDrawBoundary() {
+    if (recorders.size() > 1 && segment_size + chunk->Size() >= MIN_SEGMENT_SIZE) {
+        SplitSegment();
         return;
     }
-    EndRenderPass();
-    state.renderpass = renderpass;
-    state.framebuffer = framebuffer_handle;
-    state.render_area = render_area;
+    DispatchWork();
+}
 
-    Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
-        const VkRenderPassBeginInfo renderpass_bi{
-            .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-            .pNext = nullptr,
-            .renderPass = renderpass,
-            .framebuffer = framebuffer_handle,
-            .renderArea =
-                {
-                    .offset = {.x = 0, .y = 0},
-                    .extent = render_area,
-                },
-            .clearValueCount = 0,
-            .pClearValues = nullptr,
-        };
-        cmdbuf.BeginRenderPass(renderpass_bi, VK_SUBPASS_CONTENTS_INLINE);
-    });
-    num_renderpass_images = framebuffer->NumImages();
-    renderpass_images = framebuffer->Images();
-    renderpass_image_ranges = framebuffer->ImageRanges();
+void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
+    // Framebuffers without a render pass are bound with dynamic rendering
+    BeginPass(framebuffer, framebuffer->RenderPass() == VK_NULL_HANDLE);
+}
+
+void Scheduler::RequestRendering(const Framebuffer* framebuffer) {
+    BeginPass(framebuffer, true);
 }
 
 void Scheduler::RequestOutsideRenderPassOperationContext() {
     EndRenderPass();
 }
 
-bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline) {
-    if (state.graphics_pipeline == pipeline) {
+bool Scheduler::UpdateGraphicsPipeline(GraphicsPipeline* pipeline, VkPipeline handle) {
+    if (state.graphics_pipeline == pipeline && state.graphics_pipeline_handle == handle) {
         return false;
     }
     state.graphics_pipeline = pipeline;
+    state.graphics_pipeline_handle = handle;
     return true;
 }
 
@@ -145,17 +170,30 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
     return true;
 }
 
-void Scheduler::WorkerThread(std::stop_token stop_token) {
-    Common::SetCurrentThreadName("VulkanWorker");
+bool Scheduler::UpdateDescriptorBuffer() {
+    if (state.descriptor_buffer_bound) {
+        return false;
+    }
+    state.descriptor_buffer_bound = true;
+    return true;
+}
 
-    const auto TryPopQueue{[this](auto& work) -> bool {
-        if (work_queue.empty()) {
+void Scheduler::WorkerThread(std::stop_token stop_token, Recorder& recorder, size_t index) {
+    if (index == 0) {
+        Common::SetCurrentThreadName("VulkanWorker");
+    } else {
+        const std::string name = fmt::format("VulkanWorker:{}", index);
+        Common::SetCurrentThreadName(name.c_str());
+    }
+
+    const auto TryPopQueue{[&recorder](auto& work) -> bool {
+        if (recorder.work_queue.empty()) {
             return false;
         }
 
-        work = std::move(work_queue.front());
-        work_queue.pop();
-        event_cv.notify_all();
+        work = std::move(recorder.work_queue.front());
+        recorder.work_queue.pop();
+        recorder.event_cv.notify_all();
         return true;
     }};
 
@@ -163,10 +201,11 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
         std::unique_ptr<CommandChunk> work;
 
         {
-            std::unique_lock lk{queue_mutex};
+            std::unique_lock lk{recorder.queue_mutex};
 
             // Wait for work.
-            Common::CondvarWait(event_cv, lk, stop_token, [&] { return TryPopQueue(work); });
+            Common::CondvarWait(recorder.event_cv, lk, stop_token,
+                                [&] { return TryPopQueue(work); });
 
             // If we've been asked to stop, we're done.
             if (stop_token.stop_requested()) {
@@ -176,16 +215,22 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // Exchange lock ownership so that we take the execution lock before
             // the queue lock goes out of scope. This allows us to force execution
             // to complete in the next step.
-            std::exchange(lk, std::unique_lock{execution_mutex});
+            std::exchange(lk, std::unique_lock{recorder.execution_mutex});
 
-            // Perform the work, tracking whether the chunk was a submission
+            // Command buffers are allocated when they are first needed, so they are tagged with
+            // a tick not older than the submission they end up in.
+            if (!recorder.has_cmdbuf) {
+                AllocateWorkerCommandBuffer(recorder);
+            }
+
+            // Perform the work, tracking whether the chunk ends the command buffer
             // before executing.
-            const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            const bool ends_command_buffer = work->EndsCommandBuffer();
+            work->ExecuteAll(recorder.cmdbuf, recorder.upload_cmdbuf);
 
-            // If the chunk was a submission, reallocate the command buffer.
-            if (has_submit) {
-                AllocateWorkerCommandBuffer();
+            // If the chunk ended the command buffer, allocate a new one for the next chunk.
+            if (ends_command_buffer) {
+                recorder.has_cmdbuf = false;
             }
         }
 
@@ -198,21 +243,24 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
     }
 }
 
-void Scheduler::AllocateWorkerCommandBuffer() {
-    current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_cmdbuf.Begin({
+void Scheduler::AllocateWorkerCommandBuffer(Recorder& recorder) {
+    recorder.cmdbuf =
+        vk::CommandBuffer(recorder.command_pool->Commit(), device.GetDispatchLoader());
+    recorder.cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_upload_cmdbuf.Begin({
+    recorder.upload_cmdbuf =
+        vk::CommandBuffer(recorder.command_pool->Commit(), device.GetDispatchLoader());
+    recorder.upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
+    recorder.has_cmdbuf = true;
 }
 
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
@@ -220,8 +268,13 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
     InvalidateState();
 
     const u64 signal_value = master_semaphore->NextTick();
-    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, signal_value,
-                            this](vk::CommandBuffer cmdbuf, vk::CommandBuffer upload_cmdbuf) {
+    const VkSemaphore wait_timeline = std::exchange(submit_wait_semaphore, VkSemaphore{});
+    const u64 wait_timeline_value = std::exchange(submit_wait_tick, 0);
+    RecordWithUploadBuffer([signal_semaphore, wait_semaphore, signal_value, wait_timeline,
+                            wait_timeline_value, this,
+                            first_segment = submission_first_segment, end_segment = next_segment,
+                            submission = num_submissions++](vk::CommandBuffer cmdbuf,
+                                                            vk::CommandBuffer upload_cmdbuf) {
         static constexpr VkMemoryBarrier WRITE_BARRIER{
             .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
             .pNext = nullptr,
@@ -233,28 +286,98 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
         upload_cmdbuf.End();
         cmdbuf.End();
 
+        // Gather the segments recorded on other threads, all upload command buffers are
+        // submitted before the rest to keep the semantics of a single upload command buffer
+        const size_t num_segments = static_cast<size_t>(end_segment - first_segment);
+        std::vector<VkCommandBuffer> cmdbufs((num_segments + 1) * 2);
+        {
+            std::unique_lock lock{segment_mutex};
+            const std::stop_token stop_token = stop_source.get_token();
+            Common::CondvarWait(segment_cv, lock, stop_token, [&] {
+                if (num_submitted != submission) {
+                    return false;
+                }
+                for (u64 segment = first_segment; segment != end_segment; ++segment) {
+                    if (!recorded_segments.contains(segment)) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+            if (stop_token.stop_requested()) {
+                return;
+            }
+            for (size_t index = 0; index < num_segments; ++index) {
+                const auto node = recorded_segments.extract(first_segment + index);
+                cmdbufs[index] = node.mapped()[0];
+                cmdbufs[num_segments + 1 + index] = node.mapped()[1];
+            }
+        }
+        cmdbufs[num_segments] = *upload_cmdbuf;
+        cmdbufs.back() = *cmdbuf;
+
         if (on_submit) {
             on_submit();
         }
 
-        std::scoped_lock lock{submit_mutex};
-        switch (const VkResult result = master_semaphore->SubmitQueue(
-                    cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, signal_value)) {
-        case VK_SUCCESS:
-            break;
-        case VK_ERROR_DEVICE_LOST:
-            device.ReportLoss();
-            [[fallthrough]];
-        default:
-            vk::Check(result);
-            break;
+        {
+            std::scoped_lock lock{submit_mutex};
+            switch (const VkResult result = master_semaphore->SubmitQueue(
+                        cmdbufs, signal_semaphore, wait_semaphore, signal_value, wait_timeline,
+                        wait_timeline_value)) {
+            case VK_SUCCESS:
+                break;
+            case VK_ERROR_DEVICE_LOST:
+                device.ReportLoss();
+                [[fallthrough]];
+            default:
+                vk::Check(result);
+                break;
+            }
+        }
+        {
+            std::scoped_lock lock{segment_mutex};
+            ++num_submitted;
         }
+        segment_cv.notify_all();
     });
-    chunk->MarkSubmit();
+    chunk->MarkEndOfCommandBuffer();
     DispatchWork();
+
+    submission_first_segment = next_segment;
+    segment_size = 0;
+    current_recorder = (current_recorder + 1) % recorders.size();
     return signal_value;
 }
 
+void Scheduler::WaitOnSubmit(const MasterSemaphore& semaphore, u64 tick) {
+    ASSERT(!submit_wait_semaphore || submit_wait_semaphore == semaphore.Handle());
+    submit_wait_semaphore = semaphore.Handle();
+    submit_wait_tick = std::max(submit_wait_tick, tick);
+}
+
+void Scheduler::SplitSegment() {
+    EndPendingOperations();
+    InvalidateState();
+
+    RecordWithUploadBuffer([this, segment = next_segment++](vk::CommandBuffer cmdbuf,
+                                                            vk::CommandBuffer upload_cmdbuf) {
+        upload_cmdbuf.End();
+        cmdbuf.End();
+        {
+            std::scoped_lock lock{segment_mutex};
+            recorded_segments.emplace(segment, std::array{*upload_cmdbuf, *cmdbuf});
+        }
+        segment_cv.notify_all();
+    });
+    chunk->MarkEndOfCommandBuffer();
+    DispatchWork();
+
+    segment_size = 0;
+    current_recorder = (current_recorder + 1) % recorders.size();
+    AllocateNewContext();
+}
+
 void Scheduler::AllocateNewContext() {
     // Enable counters once again. These are disabled when a command buffer is finished.
     if (query_cache) {
@@ -271,6 +394,8 @@ void Scheduler::AllocateNewContext() {
 
 void Scheduler::InvalidateState() {
     state.graphics_pipeline = nullptr;
+    state.graphics_pipeline_handle = nullptr;
+    state.descriptor_buffer_bound = false;
     state.rescaling_defined = false;
     state_tracker.InvalidateCommandBufferState();
 }
@@ -288,12 +413,123 @@ void Scheduler::EndPendingOperations() {
     EndRenderPass();
 }
 
+bool Scheduler::CanContinuePass(const Framebuffer* framebuffer, bool dynamic_rendering) const {
+    if (!state.in_pass || dynamic_rendering != state.dynamic_rendering) {
+        return false;
+    }
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    if (!dynamic_rendering) {
+        return framebuffer->RenderPass() == state.renderpass &&
+               framebuffer->Handle() == state.framebuffer &&
+               render_area.width == state.render_area.width &&
+               render_area.height == state.render_area.height;
+    }
+    // Rendering instances are not tied to framebuffer objects, keep the current one as long as
+    // the same attachments are written. A smaller render area is contained in the current one.
+    const std::span<const VkImageView> color_views = framebuffer->ColorViews();
+    const std::span<const VkImageView> current_views(state.color_views.data(),
+                                                     state.num_color_views);
+    return std::ranges::equal(color_views, current_views) &&
+           framebuffer->DepthView() == state.depth_view &&
+           framebuffer->NumLayers() == state.layers &&
+           render_area.width <= state.render_area.width &&
+           render_area.height <= state.render_area.height;
+}
+
+void Scheduler::BeginPass(const Framebuffer* framebuffer, bool dynamic_rendering) {
+    if (CanContinuePass(framebuffer, dynamic_rendering)) {
+        return;
+    }
+    EndRenderPass();
+    const VkRenderPass renderpass = framebuffer->RenderPass();
+    const VkFramebuffer framebuffer_handle = framebuffer->Handle();
+    const VkExtent2D render_area = framebuffer->RenderArea();
+    state.in_pass = true;
+    state.renderpass = renderpass;
+    state.framebuffer = framebuffer_handle;
+    state.render_area = render_area;
+    state.dynamic_rendering = dynamic_rendering;
+
+    if (dynamic_rendering) {
+        const std::span<const VkImageView> framebuffer_views = framebuffer->ColorViews();
+        state.color_views = {};
+        std::ranges::copy(framebuffer_views, state.color_views.begin());
+        state.num_color_views = static_cast<u32>(framebuffer_views.size());
+        state.depth_view = framebuffer->DepthView();
+        state.layers = framebuffer->NumLayers();
+
+        // Images are always kept in the general layout, attachments are loaded and stored as is
+        Record([color_views = state.color_views, num_colors = framebuffer_views.size(),
+                depth_view = state.depth_view, has_depth = framebuffer->HasAspectDepthBit(),
+                has_stencil = framebuffer->HasAspectStencilBit(), layers = framebuffer->NumLayers(),
+                render_area](vk::CommandBuffer cmdbuf) {
+            const auto make_attachment = [](VkImageView view) {
+                return VkRenderingAttachmentInfo{
+                    .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                    .pNext = nullptr,
+                    .imageView = view,
+                    .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+                    .resolveMode = VK_RESOLVE_MODE_NONE,
+                    .resolveImageView = VK_NULL_HANDLE,
+                    .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                    .loadOp = VK_ATTACHMENT_LOAD_OP_LOAD,
+                    .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                    .clearValue = {},
+                };
+            };
+            std::array<VkRenderingAttachmentInfo, NUM_RT> color_attachments;
+            for (size_t index = 0; index < num_colors; ++index) {
+                color_attachments[index] = make_attachment(color_views[index]);
+            }
+            const VkRenderingAttachmentInfo depth_attachment = make_attachment(depth_view);
+            const VkRenderingInfo rendering_info{
+                .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+                .pNext = nullptr,
+                .flags = 0,
+                .renderArea =
+                    {
+                        .offset = {.x = 0, .y = 0},
+                        .extent = render_area,
+                    },
+                .layerCount = layers,
+                .viewMask = 0,
+                .colorAttachmentCount = static_cast<u32>(num_colors),
+                .pColorAttachments = color_attachments.data(),
+                .pDepthAttachment = has_depth ? &depth_attachment : nullptr,
+                .pStencilAttachment = has_stencil ? &depth_attachment : nullptr,
+            };
+            cmdbuf.BeginRendering(rendering_info);
+        });
+    } else {
+        Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
+            const VkRenderPassBeginInfo renderpass_bi{
+                .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                .pNext = nullptr,
+                .renderPass = renderpass,
+                .framebuffer = framebuffer_handle,
+                .renderArea =
+                    {
+                        .offset = {.x = 0, .y = 0},
+                        .extent = render_area,
+                    },
+                .clearValueCount = 0,
+                .pClearValues = nullptr,
+            };
+            cmdbuf.BeginRenderPass(renderpass_bi, VK_SUBPASS_CONTENTS_INLINE);
+        });
+    }
+    num_renderpass_images = framebuffer->NumImages();
+    renderpass_images = framebuffer->Images();
+    renderpass_image_ranges = framebuffer->ImageRanges();
+}
+
 void Scheduler::EndRenderPass() {
-    if (!state.renderpass) {
+    if (!state.in_pass) {
         return;
     }
     Record([num_images = num_renderpass_images, images = renderpass_images,
-            ranges = renderpass_image_ranges](vk::CommandBuffer cmdbuf) {
+            ranges = renderpass_image_ranges,
+            dynamic_rendering = state.dynamic_rendering](vk::CommandBuffer cmdbuf) {
         std::array<VkImageMemoryBarrier, 9> barriers;
         for (size_t i = 0; i < num_images; ++i) {
             barriers[i] = VkImageMemoryBarrier{
@@ -314,14 +550,21 @@ void Scheduler::EndRenderPass() {
                 .subresourceRange = ranges[i],
             };
         }
-        cmdbuf.EndRenderPass();
+        if (dynamic_rendering) {
+            cmdbuf.EndRendering();
+        } else {
+            cmdbuf.EndRenderPass();
+        }
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
                                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
                                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, nullptr, nullptr,
                                vk::Span(barriers.data(), num_images));
     });
+    state.in_pass = false;
     state.renderpass = nullptr;
+    state.framebuffer = nullptr;
+    state.dynamic_rendering = false;
     num_renderpass_images = 0;
 }
 
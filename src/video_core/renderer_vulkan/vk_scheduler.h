@@ -3,18 +3,23 @@
 
 #pragma once
 
+#include <array>
 #include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <queue>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/texture_cache/types.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
@@ -52,19 +57,30 @@ public:
     /// Sends currently recorded work to the worker thread.
     void DispatchWork();
 
+    /// Sends currently recorded work to the worker threads. Must only be called between draws,
+    /// where command buffer state can be dropped to record the following work in parallel.
+    void DispatchWorkAtDrawBoundary();
+
     /// Requests to begin a renderpass.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Requests to begin a dynamic rendering instance (VK_KHR_dynamic_rendering).
+    void RequestRendering(const Framebuffer* framebuffer);
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
 
-    /// Update the pipeline to the current execution context.
-    bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline);
+    /// Update the pipeline to the current execution context. The handle changes when a pipeline
+    /// swaps in an optimized version of itself.
+    bool UpdateGraphicsPipeline(GraphicsPipeline* pipeline, VkPipeline handle);
 
     /// Update the rescaling state. Returns true if the state has to be updated.
     bool UpdateRescaling(bool is_rescaling);
 
+    /// Returns true if the descriptor buffer ring has to be bound to the current command buffer.
+    bool UpdateDescriptorBuffer();
+
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
@@ -73,6 +89,9 @@ public:
         query_cache = &query_cache_;
     }
 
+    /// Makes the next submission wait for the timeline of another queue to reach a tick.
+    void WaitOnSubmit(const MasterSemaphore& semaphore, u64 tick);
+
     // Registers a callback to perform on queue submission.
     void RegisterOnSubmit(std::function<void()>&& func) {
         on_submit = std::move(func);
@@ -185,16 +204,20 @@ private:
             return true;
         }
 
-        void MarkSubmit() {
-            submit = true;
+        void MarkEndOfCommandBuffer() {
+            ends_command_buffer = true;
         }
 
         bool Empty() const {
             return command_offset == 0;
         }
 
-        bool HasSubmit() const {
-            return submit;
+        size_t Size() const {
+            return command_offset;
+        }
+
+        bool EndsCommandBuffer() const {
+            return ends_command_buffer;
         }
 
     private:
@@ -202,7 +225,7 @@ private:
         Command* last = nullptr;
 
         size_t command_offset = 0;
-        bool submit = false;
+        bool ends_command_buffer = false;
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
 
@@ -210,52 +233,91 @@ private:
         VkRenderPass renderpass = nullptr;
         VkFramebuffer framebuffer = nullptr;
         VkExtent2D render_area = {0, 0};
+        std::array<VkImageView, VideoCommon::NUM_RT> color_views{};
+        VkImageView depth_view = nullptr;
+        u32 num_color_views = 0;
+        u32 layers = 0;
+        bool in_pass = false;
         GraphicsPipeline* graphics_pipeline = nullptr;
+        VkPipeline graphics_pipeline_handle = nullptr;
+        bool dynamic_rendering = false;
+        bool descriptor_buffer_bound = false;
         bool is_rescaling = false;
         bool rescaling_defined = false;
     };
 
-    void WorkerThread(std::stop_token stop_token);
+    /// Worker thread executing chunks into command buffers of its own
+    struct Recorder {
+        std::unique_ptr<CommandPool> command_pool;
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+        bool has_cmdbuf = false;
+
+        std::queue<std::unique_ptr<CommandChunk>> work_queue;
+        std::mutex execution_mutex;
+        std::mutex queue_mutex;
+        std::condition_variable_any event_cv;
+        std::jthread thread;
+    };
+
+    void WorkerThread(std::stop_token stop_token, Recorder& recorder, size_t index);
 
-    void AllocateWorkerCommandBuffer();
+    void AllocateWorkerCommandBuffer(Recorder& recorder);
 
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
+    /// Ends the command buffer of the current segment and starts a new one on the next recorder.
+    void SplitSegment();
+
     void AllocateNewContext();
 
     void EndPendingOperations();
 
     void EndRenderPass();
 
+    /// Returns true if draws to the framebuffer can be recorded in the current pass
+    bool CanContinuePass(const Framebuffer* framebuffer, bool dynamic_rendering) const;
+
+    void BeginPass(const Framebuffer* framebuffer, bool dynamic_rendering);
+
     void AcquireNewChunk();
 
     const Device& device;
     StateTracker& state_tracker;
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
-    std::unique_ptr<CommandPool> command_pool;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
 
-    vk::CommandBuffer current_cmdbuf;
-    vk::CommandBuffer current_upload_cmdbuf;
-
     std::unique_ptr<CommandChunk> chunk;
     std::function<void()> on_submit;
 
+    VkSemaphore submit_wait_semaphore{};
+    u64 submit_wait_tick = 0;
+
     State state;
 
     u32 num_renderpass_images = 0;
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
 
-    std::queue<std::unique_ptr<CommandChunk>> work_queue;
+    // Segments are the parts of a submission recorded into separate command buffers
+    size_t segment_size = 0;
+    u64 next_segment = 0;
+    u64 submission_first_segment = 0;
+    u64 num_submissions = 0;
+
+    std::unordered_map<u64, std::array<VkCommandBuffer, 2>> recorded_segments;
+    u64 num_submitted = 0;
+    std::mutex segment_mutex;
+    std::condition_variable_any segment_cv;
+    std::stop_source stop_source;
+
     std::vector<std::unique_ptr<CommandChunk>> chunk_reserve;
-    std::mutex execution_mutex;
     std::mutex reserve_mutex;
-    std::mutex queue_mutex;
-    std::condition_variable_any event_cv;
-    std::jthread worker_thread;
+
+    std::vector<std::unique_ptr<Recorder>> recorders;
+    size_t current_recorder = 0;
 };
 
 } // namespace Vulkan
@@ -89,6 +89,9 @@ private:
 
     StagingBufferRef CreateStagingBuffer(size_t size, MemoryUsage usage, bool deferred);
 
+    /// Shares the buffer with the async compute queue family when there is one
+    void SetSharingMode(VkBufferCreateInfo& buffer_ci) const;
+
     StagingBuffersCache& GetCache(MemoryUsage usage);
 
     void ReleaseCache(MemoryUsage usage);
@@ -101,6 +104,7 @@ private:
     const Device& device;
     MemoryAllocator& memory_allocator;
     Scheduler& scheduler;
+    std::array<u32, 2> queue_families{};
 
     vk::Buffer stream_buffer;
     std::span<u8> stream_pointer;
@@ -58,6 +58,7 @@ Flags MakeInvalidationFlags() {
         ColorMask,
         BlendEquations,
         BlendEnable,
+        ShaderObjectState,
     };
     Flags flags{};
     for (const int flag : INVALIDATION_FLAGS) {
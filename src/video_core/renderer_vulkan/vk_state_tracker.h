@@ -62,6 +62,8 @@ enum : u8 {
     ColorMask,
     ViewportSwizzles,
 
+    ShaderObjectState,
+
     Last,
 };
 static_assert(Last <= std::numeric_limits<u8>::max());
@@ -248,6 +250,10 @@ public:
         return Exchange(Dirty::LogicOp, false);
     }
 
+    bool TouchShaderObjectState() {
+        return Exchange(Dirty::ShaderObjectState, false);
+    }
+
     bool ChangePrimitiveTopology(Maxwell::PrimitiveTopology new_topology) {
         const bool has_changed = current_topology != new_topology;
         current_topology = new_topology;
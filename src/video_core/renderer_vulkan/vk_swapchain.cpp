@@ -162,11 +162,18 @@ bool Swapchain::AcquireNextImage() {
     return is_suboptimal || is_outdated;
 }
 
-void Swapchain::Present(VkSemaphore render_semaphore) {
+void Swapchain::Present(VkSemaphore render_semaphore, u64 present_id) {
     const auto present_queue{device.GetPresentQueue()};
+    const bool use_present_id{present_id != 0 && device.IsKhrPresentWaitSupported()};
+    const VkPresentIdKHR present_id_info{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &present_id,
+    };
     const VkPresentInfoKHR present_info{
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .pNext = nullptr,
+        .pNext = use_present_id ? &present_id_info : nullptr,
         .waitSemaphoreCount = render_semaphore ? 1U : 0U,
         .pWaitSemaphores = &render_semaphore,
         .swapchainCount = 1,
@@ -197,6 +204,29 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
     }
 }
 
+bool Swapchain::WaitForPresent(u64 present_id, u64 timeout) {
+    switch (const VkResult result = swapchain.WaitForPresentKHR(present_id, timeout)) {
+    case VK_SUCCESS:
+        return true;
+    case VK_TIMEOUT:
+        return false;
+    case VK_ERROR_OUT_OF_DATE_KHR:
+        // The image will never be displayed, don't keep anyone waiting for it
+        is_outdated = true;
+        return true;
+    case VK_ERROR_SURFACE_LOST_KHR:
+        vk::Check(result);
+        return true;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        vk::Check(result);
+        return true;
+    default:
+        LOG_ERROR(Render_Vulkan, "vkWaitForPresentKHR returned {}", string_VkResult(result));
+        return true;
+    }
+}
+
 void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const auto physical_device{device.GetPhysical()};
     const auto formats{physical_device.GetSurfaceFormatsKHR(surface)};
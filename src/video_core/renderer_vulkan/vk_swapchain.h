@@ -30,7 +30,12 @@ public:
     bool AcquireNextImage();
 
     /// Presents the rendered image to the swapchain.
-    void Present(VkSemaphore render_semaphore);
+    /// A non-zero present id can be waited on with WaitForPresent (VK_KHR_present_wait).
+    void Present(VkSemaphore render_semaphore, u64 present_id = 0);
+
+    /// Waits until the image with the given present id is displayed, or the timeout expires.
+    /// Returns true when the image is not pending display anymore.
+    bool WaitForPresent(u64 present_id, u64 timeout);
 
     /// Returns true when the swapchain needs to be recreated.
     bool NeedsRecreation() const {
@@ -8,7 +8,9 @@
 #include "video_core/texture_cache/texture_cache_base.h"
 
 #include "shader_recompiler/shader_info.h"
+#include "video_core/renderer_vulkan/vk_async_compute_queue.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
@@ -118,6 +120,7 @@ public:
     StagingBufferPool& staging_buffer_pool;
     BlitImageHelper& blit_image_helper;
     RenderPassCache& render_pass_cache;
+    std::unique_ptr<AsyncComputeQueue> async_compute_queue;
     std::optional<ASTCDecoderPass> astc_decoder_pass;
     std::unique_ptr<MSAACopyPass> msaa_copy_pass;
     const Settings::ResolutionScalingInfo& resolution;
@@ -321,10 +324,16 @@ public:
         return *framebuffer;
     }
 
+    /// Returns the render pass of the framebuffer, null when it is bound with dynamic rendering
     [[nodiscard]] VkRenderPass RenderPass() const noexcept {
         return renderpass;
     }
 
+    /// Returns the attachment formats pipelines drawing to this framebuffer are built for
+    [[nodiscard]] const RenderPassKey& GetRenderPassKey() const noexcept {
+        return renderpass_key;
+    }
+
     [[nodiscard]] VkExtent2D RenderArea() const noexcept {
         return render_area;
     }
@@ -365,9 +374,23 @@ public:
         return is_rescaled;
     }
 
+    /// Returns the color attachment views indexed by render target, for dynamic rendering
+    [[nodiscard]] std::span<const VkImageView> ColorViews() const noexcept {
+        return std::span(color_views.data(), num_color_views);
+    }
+
+    [[nodiscard]] VkImageView DepthView() const noexcept {
+        return depth_view;
+    }
+
+    [[nodiscard]] u32 NumLayers() const noexcept {
+        return layers;
+    }
+
 private:
     vk::Framebuffer framebuffer;
     VkRenderPass renderpass{};
+    RenderPassKey renderpass_key{};
     VkExtent2D render_area{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
     u32 num_color_buffers = 0;
@@ -375,6 +398,10 @@ private:
     std::array<VkImage, 9> images{};
     std::array<VkImageSubresourceRange, 9> image_ranges{};
     std::array<size_t, NUM_RT> rt_map{};
+    std::array<VkImageView, NUM_RT> color_views{};
+    VkImageView depth_view{};
+    u32 num_color_views = 0;
+    u32 layers = 1;
     bool has_depth{};
     bool has_stencil{};
     bool is_rescaled{};
@@ -30,7 +30,8 @@ std::unique_ptr<VideoCore::RendererBase> CreateRenderer(
         return std::make_unique<Vulkan::RendererVulkan>(telemetry_session, emu_window,
                                                         device_memory, gpu, std::move(context));
     case Settings::RendererBackend::Null:
-        return std::make_unique<Null::RendererNull>(emu_window, gpu, std::move(context));
+        return std::make_unique<Null::RendererNull>(emu_window, device_memory, gpu,
+                                                    std::move(context));
     default:
         return nullptr;
     }
@@ -45,7 +46,9 @@ std::unique_ptr<Tegra::GPU> CreateGPU(Core::Frontend::EmuWindow& emu_window, Cor
 
     const auto nvdec_value = Settings::values.nvdec_emulation.GetValue();
     const bool use_nvdec = nvdec_value != Settings::NvdecEmulation::Off;
-    const bool use_async = Settings::values.use_asynchronous_gpu_emulation.GetValue();
+    // Traces are captured in the order the CPU submits work, which the GPU thread would break
+    const bool use_async = Settings::values.use_asynchronous_gpu_emulation.GetValue() &&
+                           !Settings::values.gpu_trace_capture.GetValue();
     auto gpu = std::make_unique<Tegra::GPU>(system, use_async, use_nvdec);
     auto context = emu_window.CreateSharedContext();
     auto scope = context->Acquire();
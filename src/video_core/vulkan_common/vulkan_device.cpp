@@ -716,18 +716,36 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
         dynamic_state3_enables = false;
     }
 
+    // Shader objects have no pipeline to bake state into, every state we use has to be dynamic
+    if (extensions.shader_object &&
+        (!extensions.extended_dynamic_state || !extensions.extended_dynamic_state2 ||
+         !IsExtExtendedDynamicState2ExtrasSupported() || !dynamic_state3_blending ||
+         !dynamic_state3_enables || !extensions.vertex_input_dynamic_state)) {
+        LOG_INFO(Render_Vulkan, "Removing shaderObject due to missing dynamic state features");
+        RemoveExtensionFeature(extensions.shader_object, features.shader_object,
+                               VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    }
+
     logical = vk::Device::Create(physical, queue_cis, ExtensionListForVulkan(loaded_extensions),
                                  first_next, dld);
 
     graphics_queue = logical.GetQueue(graphics_family);
     present_queue = logical.GetQueue(present_family);
+    if (has_async_compute) {
+        compute_queue = logical.GetQueue(compute_family);
+    }
 
     VmaVulkanFunctions functions{};
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
     functions.vkGetDeviceProcAddr = dld.vkGetDeviceProcAddr;
 
+    VmaAllocatorCreateFlags allocator_flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT;
+    if (extensions.descriptor_buffer) {
+        allocator_flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
+
     const VmaAllocatorCreateInfo allocator_info = {
-        .flags = VMA_ALLOCATOR_CREATE_EXTERNALLY_SYNCHRONIZED_BIT,
+        .flags = allocator_flags,
         .physicalDevice = physical,
         .device = *logical,
         .preferredLargeHeapBlockSize = 0,
@@ -1096,6 +1114,21 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
         SetNext(next, properties.transform_feedback);
     }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
+    if (extensions.descriptor_buffer) {
+        properties.descriptor_buffer.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        SetNext(next, properties.descriptor_buffer);
+    }
+    if (extensions.external_memory_host) {
+        properties.external_memory_host.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+        SetNext(next, properties.external_memory_host);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1177,6 +1210,21 @@ void Device::RemoveUnsuitableExtensions() {
                                        features.extended_dynamic_state3,
                                        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
 
+    // VK_EXT_graphics_pipeline_library
+    if (Settings::values.use_vulkan_graphics_pipeline_library.GetValue()) {
+        extensions.graphics_pipeline_library =
+            extensions.pipeline_library &&
+            features.graphics_pipeline_library.graphicsPipelineLibrary &&
+            properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking;
+        RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                           features.graphics_pipeline_library,
+                                           VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.graphics_pipeline_library,
+                               features.graphics_pipeline_library,
+                               VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    }
+
     // VK_EXT_provoking_vertex
     extensions.provoking_vertex =
         features.provoking_vertex.provokingVertexLast &&
@@ -1206,6 +1254,72 @@ void Device::RemoveUnsuitableExtensions() {
                                        features.subgroup_size_control,
                                        VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME);
 
+    // VK_KHR_dynamic_rendering
+    extensions.dynamic_rendering = features.dynamic_rendering.dynamicRendering;
+    RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering, features.dynamic_rendering,
+                                       VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    use_dynamic_rendering =
+        extensions.dynamic_rendering && Settings::values.use_vulkan_dynamic_rendering.GetValue();
+
+    // VK_KHR_present_id and VK_KHR_present_wait
+    extensions.present_id = features.present_id.presentId;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_id, features.present_id,
+                                       VK_KHR_PRESENT_ID_EXTENSION_NAME);
+    extensions.present_wait = features.present_wait.presentWait && extensions.present_id;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_wait, features.present_wait,
+                                       VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
+    // VK_EXT_shader_object
+    if (Settings::values.use_vulkan_shader_objects.GetValue()) {
+        extensions.shader_object =
+            features.shader_object.shaderObject && extensions.dynamic_rendering;
+        RemoveExtensionFeatureIfUnsuitable(extensions.shader_object, features.shader_object,
+                                           VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.shader_object, features.shader_object,
+                               VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+    }
+
+    // VK_EXT_descriptor_buffer
+    if (Settings::values.use_vulkan_descriptor_buffer.GetValue()) {
+        extensions.descriptor_buffer =
+            features.descriptor_buffer.descriptorBuffer && extensions.buffer_device_address &&
+            features.buffer_device_address.bufferDeviceAddress &&
+            properties.descriptor_buffer.combinedImageSamplerDescriptorSingleArray;
+        RemoveExtensionFeatureIfUnsuitable(extensions.descriptor_buffer, features.descriptor_buffer,
+                                           VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.descriptor_buffer, features.descriptor_buffer,
+                               VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    }
+    if (extensions.descriptor_buffer) {
+        // Capture and replay support has a cost on some drivers and is never used
+        features.descriptor_buffer.descriptorBufferCaptureReplay = false;
+        features.buffer_device_address.bufferDeviceAddressCaptureReplay = false;
+        features.buffer_device_address.bufferDeviceAddressMultiDevice = false;
+    } else {
+        // Device addresses are only used by descriptor buffers
+        RemoveExtensionFeature(extensions.buffer_device_address, features.buffer_device_address,
+                               VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+    }
+
+    // VK_EXT_external_memory_host
+    // Importing guest memory only pays off when the device reads host memory at full speed
+    const VkPhysicalDeviceType device_type{properties.properties.deviceType};
+    const bool is_unified_memory = device_type == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU ||
+                                   device_type == VK_PHYSICAL_DEVICE_TYPE_CPU;
+    if (Settings::values.use_vulkan_host_memory_import.GetValue() && is_unified_memory) {
+        // Guest memory is only guaranteed to be contiguous in 4 KiB pages
+        extensions.external_memory_host =
+            extensions.external_memory_host &&
+            properties.external_memory_host.minImportedHostPointerAlignment <= 4_KiB;
+        RemoveExtensionIfUnsuitable(extensions.external_memory_host,
+                                    VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+    } else {
+        RemoveExtension(extensions.external_memory_host,
+                        VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+    }
+
     // VK_EXT_transform_feedback
     extensions.transform_feedback =
         features.transform_feedback.transformFeedback &&
@@ -1282,6 +1396,21 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     if (present) {
         present_family = *present;
     }
+
+    // Decode and utility passes can overlap rendering on a compute only family. Submissions to it
+    // are ordered with the graphics queue through timeline semaphores.
+    if (!Settings::values.use_vulkan_async_compute.GetValue() || !HasTimelineSemaphore()) {
+        return;
+    }
+    for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
+        const VkQueueFamilyProperties& queue_family = queue_family_properties[index];
+        if (queue_family.queueCount > 0 && (queue_family.queueFlags & VK_QUEUE_COMPUTE_BIT) &&
+            !(queue_family.queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+            compute_family = index;
+            has_async_compute = true;
+            break;
+        }
+    }
 }
 
 u64 Device::GetDeviceMemoryUsage() const {
@@ -1360,6 +1489,9 @@ std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
     static constexpr float QUEUE_PRIORITY = 1.0f;
 
     std::unordered_set<u32> unique_queue_families{graphics_family, present_family};
+    if (has_async_compute) {
+        unique_queue_families.insert(compute_family);
+    }
     std::vector<VkDeviceQueueCreateInfo> queue_cis;
     queue_cis.reserve(unique_queue_families.size());
 
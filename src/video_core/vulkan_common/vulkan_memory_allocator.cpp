@@ -251,7 +251,13 @@ vk::Image MemoryAllocator::CreateImage(const VkImageCreateInfo& ci) const {
                      device.GetDispatchLoader());
 }
 
-vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const {
+vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& buffer_ci,
+                                         MemoryUsage usage) const {
+    VkBufferCreateInfo ci{buffer_ci};
+    if (device.IsExtDescriptorBufferSupported()) {
+        // Descriptors written to descriptor buffers reference buffers by device address
+        ci.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
     const VmaAllocationCreateInfo alloc_ci = {
         .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
         .usage = MemoryUsageVma(usage),
@@ -279,6 +285,73 @@ vk::Buffer MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsa
                       device.GetDispatchLoader());
 }
 
+vk::Buffer MemoryAllocator::CreateImportedBuffer(const VkBufferCreateInfo& buffer_ci,
+                                                 void* host_pointer,
+                                                 vk::DeviceMemory& memory) const {
+    const vk::Device& logical = device.GetLogical();
+    const vk::DeviceDispatch& dld = device.GetDispatchLoader();
+    const u32 type_mask = logical.GetMemoryHostPointerTypeBitsEXT(host_pointer);
+    if (type_mask == 0) {
+        return {};
+    }
+    // Host coherent memory makes CPU writes visible to the GPU without explicit flushes
+    std::optional<u32> type_index =
+        FindType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                 type_mask);
+    if (!type_index) {
+        return {};
+    }
+    const VkExternalMemoryBufferCreateInfo external_ci{
+        .sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO,
+        .pNext = buffer_ci.pNext,
+        .handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+    };
+    VkBufferCreateInfo ci{buffer_ci};
+    ci.pNext = &external_ci;
+    const bool uses_device_address = device.IsExtDescriptorBufferSupported();
+    if (uses_device_address) {
+        ci.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+    VkBuffer handle{};
+    if (dld.vkCreateBuffer(*logical, &ci, nullptr, &handle) != VK_SUCCESS) {
+        return {};
+    }
+    // Without an allocation VMA only destroys the buffer handle, the memory is owned by the caller
+    vk::Buffer buffer(handle, *logical, allocator, nullptr, {}, true, dld);
+
+    const VkMemoryAllocateFlagsInfo flags_info{
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+        .pNext = nullptr,
+        .flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT,
+        .deviceMask = 0,
+    };
+    const VkImportMemoryHostPointerInfoEXT import_info{
+        .sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT,
+        .pNext = uses_device_address ? &flags_info : nullptr,
+        .handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+        .pHostPointer = host_pointer,
+    };
+    const VkMemoryRequirements requirements = logical.GetBufferMemoryRequirements(handle);
+    if ((requirements.memoryTypeBits & (1U << *type_index)) == 0 ||
+        requirements.size > ci.size) {
+        return {};
+    }
+    vk::DeviceMemory imported_memory = logical.TryAllocateMemory({
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .pNext = &import_info,
+        .allocationSize = ci.size,
+        .memoryTypeIndex = *type_index,
+    });
+    if (!imported_memory) {
+        return {};
+    }
+    if (dld.vkBindBufferMemory(*logical, handle, *imported_memory, 0) != VK_SUCCESS) {
+        return {};
+    }
+    memory = std::move(imported_memory);
+    return buffer;
+}
+
 MemoryCommit MemoryAllocator::Commit(const VkMemoryRequirements& requirements, MemoryUsage usage) {
     // Find the fastest memory flags we can afford with the current requirements
     const u32 type_mask = requirements.memoryTypeBits;
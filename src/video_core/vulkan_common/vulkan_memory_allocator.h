@@ -101,6 +101,19 @@ public:
 
     vk::Buffer CreateBuffer(const VkBufferCreateInfo& ci, MemoryUsage usage) const;
 
+    /**
+     * Creates a buffer backed by host memory imported with VK_EXT_external_memory_host.
+     * The host memory has to outlive the buffer and the imported memory.
+     *
+     * @param ci           Buffer create info, the size has to be aligned to the import alignment
+     * @param host_pointer Host pointer aligned to the minimum imported host pointer alignment
+     * @param memory       Receives the imported memory the buffer is bound to
+     *
+     * @returns The created buffer, or a null buffer when the pointer can't be imported.
+     */
+    vk::Buffer CreateImportedBuffer(const VkBufferCreateInfo& ci, void* host_pointer,
+                                    vk::DeviceMemory& memory) const;
+
     /**
      * Commits a memory with the specified requirements.
      *
@@ -89,11 +89,14 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdBeginConditionalRenderingEXT);
     X(vkCmdBeginQuery);
     X(vkCmdBeginRenderPass);
+    X(vkCmdBeginRendering);
     X(vkCmdBeginTransformFeedbackEXT);
     X(vkCmdBeginDebugUtilsLabelEXT);
+    X(vkCmdBindDescriptorBuffersEXT);
     X(vkCmdBindDescriptorSets);
     X(vkCmdBindIndexBuffer);
     X(vkCmdBindPipeline);
+    X(vkCmdBindShadersEXT);
     X(vkCmdBindTransformFeedbackBuffersEXT);
     X(vkCmdBindVertexBuffers);
     X(vkCmdBlitImage);
@@ -116,6 +119,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdEndConditionalRenderingEXT);
     X(vkCmdEndQuery);
     X(vkCmdEndRenderPass);
+    X(vkCmdEndRendering);
     X(vkCmdEndTransformFeedbackEXT);
     X(vkCmdEndDebugUtilsLabelEXT);
     X(vkCmdFillBuffer);
@@ -125,6 +129,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetBlendConstants);
     X(vkCmdSetDepthBias);
     X(vkCmdSetDepthBias2EXT);
+    X(vkCmdSetDescriptorBufferOffsetsEXT);
     X(vkCmdSetDepthBounds);
     X(vkCmdSetEvent);
     X(vkCmdSetScissor);
@@ -155,6 +160,22 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetColorWriteMaskEXT);
     X(vkCmdSetColorBlendEnableEXT);
     X(vkCmdSetColorBlendEquationEXT);
+    X(vkCmdSetAlphaToCoverageEnableEXT);
+    X(vkCmdSetAlphaToOneEnableEXT);
+    X(vkCmdSetConservativeRasterizationModeEXT);
+    X(vkCmdSetDepthClipNegativeOneToOneEXT);
+    X(vkCmdSetExtraPrimitiveOverestimationSizeEXT);
+    X(vkCmdSetLineRasterizationModeEXT);
+    X(vkCmdSetLineStippleEnableEXT);
+    X(vkCmdSetPolygonModeEXT);
+    X(vkCmdSetProvokingVertexModeEXT);
+    X(vkCmdSetRasterizationSamplesEXT);
+    X(vkCmdSetRasterizationStreamEXT);
+    X(vkCmdSetSampleMaskEXT);
+    X(vkCmdSetScissorWithCountEXT);
+    X(vkCmdSetTessellationDomainOriginEXT);
+    X(vkCmdSetViewportSwizzleNV);
+    X(vkCmdSetViewportWithCountEXT);
     X(vkCmdResolveImage);
     X(vkCreateBuffer);
     X(vkCreateBufferView);
@@ -176,6 +197,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCreateSampler);
     X(vkCreateSemaphore);
     X(vkCreateShaderModule);
+    X(vkCreateShadersEXT);
     X(vkCreateSwapchainKHR);
     X(vkDestroyBuffer);
     X(vkDestroyBufferView);
@@ -195,6 +217,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkDestroyRenderPass);
     X(vkDestroySampler);
     X(vkDestroySemaphore);
+    X(vkDestroyShaderEXT);
     X(vkDestroyShaderModule);
     X(vkDestroySwapchainKHR);
     X(vkDeviceWaitIdle);
@@ -202,13 +225,18 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkFreeCommandBuffers);
     X(vkFreeDescriptorSets);
     X(vkFreeMemory);
+    X(vkGetBufferDeviceAddress);
     X(vkGetBufferMemoryRequirements2);
+    X(vkGetDescriptorEXT);
+    X(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    X(vkGetDescriptorSetLayoutSizeEXT);
     X(vkGetDeviceQueue);
     X(vkGetEventStatus);
     X(vkGetFenceStatus);
     X(vkGetImageMemoryRequirements);
     X(vkGetPipelineCacheData);
     X(vkGetMemoryFdKHR);
+    X(vkGetMemoryHostPointerPropertiesEXT);
 #ifdef _WIN32
     X(vkGetMemoryWin32HandleKHR);
 #endif
@@ -226,6 +254,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkUpdateDescriptorSetWithTemplate);
     X(vkUpdateDescriptorSets);
     X(vkWaitForFences);
+    X(vkWaitForPresentKHR);
     X(vkWaitSemaphores);
 
     // Support for timeline semaphores is mandatory in Vulkan 1.2
@@ -244,6 +273,17 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
         Proc(dld.vkCmdDrawIndirectCount, dld, "vkCmdDrawIndirectCountKHR", device);
         Proc(dld.vkCmdDrawIndexedIndirectCount, dld, "vkCmdDrawIndexedIndirectCountKHR", device);
     }
+
+    // Support for buffer device addresses is mandatory in Vulkan 1.3
+    if (!dld.vkGetBufferDeviceAddress) {
+        Proc(dld.vkGetBufferDeviceAddress, dld, "vkGetBufferDeviceAddressKHR", device);
+    }
+
+    // Support for dynamic rendering is mandatory in Vulkan 1.3
+    if (!dld.vkCmdBeginRendering) {
+        Proc(dld.vkCmdBeginRendering, dld, "vkCmdBeginRenderingKHR", device);
+        Proc(dld.vkCmdEndRendering, dld, "vkCmdEndRenderingKHR", device);
+    }
 #undef X
 }
 
@@ -391,6 +431,10 @@ void Destroy(VkDevice device, VkSemaphore handle, const DeviceDispatch& dld) noe
     dld.vkDestroySemaphore(device, handle, nullptr);
 }
 
+void Destroy(VkDevice device, VkShaderEXT handle, const DeviceDispatch& dld) noexcept {
+    dld.vkDestroyShaderEXT(device, handle, nullptr);
+}
+
 void Destroy(VkDevice device, VkShaderModule handle, const DeviceDispatch& dld) noexcept {
     dld.vkDestroyShaderModule(device, handle, nullptr);
 }
@@ -765,6 +809,12 @@ ShaderModule Device::CreateShaderModule(const VkShaderModuleCreateInfo& ci) cons
     return ShaderModule(object, handle, *dld);
 }
 
+ShaderEXT Device::CreateShaderEXT(const VkShaderCreateInfoEXT& ci) const {
+    VkShaderEXT object;
+    Check(dld->vkCreateShadersEXT(handle, 1, &ci, nullptr, &object));
+    return ShaderEXT(object, handle, *dld);
+}
+
 Event Device::CreateEvent() const {
     static constexpr VkEventCreateInfo ci{
         .sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO,
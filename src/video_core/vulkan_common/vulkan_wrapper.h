@@ -189,10 +189,13 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT{};
     PFN_vkCmdBeginQuery vkCmdBeginQuery{};
     PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass{};
+    PFN_vkCmdBeginRendering vkCmdBeginRendering{};
     PFN_vkCmdBeginTransformFeedbackEXT vkCmdBeginTransformFeedbackEXT{};
+    PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT{};
     PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets{};
     PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer{};
     PFN_vkCmdBindPipeline vkCmdBindPipeline{};
+    PFN_vkCmdBindShadersEXT vkCmdBindShadersEXT{};
     PFN_vkCmdBindTransformFeedbackBuffersEXT vkCmdBindTransformFeedbackBuffersEXT{};
     PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers{};
     PFN_vkCmdBindVertexBuffers2EXT vkCmdBindVertexBuffers2EXT{};
@@ -217,6 +220,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT{};
     PFN_vkCmdEndQuery vkCmdEndQuery{};
     PFN_vkCmdEndRenderPass vkCmdEndRenderPass{};
+    PFN_vkCmdEndRendering vkCmdEndRendering{};
     PFN_vkCmdEndTransformFeedbackEXT vkCmdEndTransformFeedbackEXT{};
     PFN_vkCmdFillBuffer vkCmdFillBuffer{};
     PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier{};
@@ -227,6 +231,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdSetCullModeEXT vkCmdSetCullModeEXT{};
     PFN_vkCmdSetDepthBias vkCmdSetDepthBias{};
     PFN_vkCmdSetDepthBias2EXT vkCmdSetDepthBias2EXT{};
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT{};
     PFN_vkCmdSetDepthBounds vkCmdSetDepthBounds{};
     PFN_vkCmdSetDepthBoundsTestEnableEXT vkCmdSetDepthBoundsTestEnableEXT{};
     PFN_vkCmdSetDepthCompareOpEXT vkCmdSetDepthCompareOpEXT{};
@@ -254,6 +259,23 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCmdSetColorWriteMaskEXT vkCmdSetColorWriteMaskEXT{};
     PFN_vkCmdSetColorBlendEnableEXT vkCmdSetColorBlendEnableEXT{};
     PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT{};
+    PFN_vkCmdSetAlphaToCoverageEnableEXT vkCmdSetAlphaToCoverageEnableEXT{};
+    PFN_vkCmdSetAlphaToOneEnableEXT vkCmdSetAlphaToOneEnableEXT{};
+    PFN_vkCmdSetConservativeRasterizationModeEXT vkCmdSetConservativeRasterizationModeEXT{};
+    PFN_vkCmdSetDepthClipNegativeOneToOneEXT vkCmdSetDepthClipNegativeOneToOneEXT{};
+    PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT
+        vkCmdSetExtraPrimitiveOverestimationSizeEXT{};
+    PFN_vkCmdSetLineRasterizationModeEXT vkCmdSetLineRasterizationModeEXT{};
+    PFN_vkCmdSetLineStippleEnableEXT vkCmdSetLineStippleEnableEXT{};
+    PFN_vkCmdSetPolygonModeEXT vkCmdSetPolygonModeEXT{};
+    PFN_vkCmdSetProvokingVertexModeEXT vkCmdSetProvokingVertexModeEXT{};
+    PFN_vkCmdSetRasterizationSamplesEXT vkCmdSetRasterizationSamplesEXT{};
+    PFN_vkCmdSetRasterizationStreamEXT vkCmdSetRasterizationStreamEXT{};
+    PFN_vkCmdSetSampleMaskEXT vkCmdSetSampleMaskEXT{};
+    PFN_vkCmdSetScissorWithCountEXT vkCmdSetScissorWithCountEXT{};
+    PFN_vkCmdSetTessellationDomainOriginEXT vkCmdSetTessellationDomainOriginEXT{};
+    PFN_vkCmdSetViewportSwizzleNV vkCmdSetViewportSwizzleNV{};
+    PFN_vkCmdSetViewportWithCountEXT vkCmdSetViewportWithCountEXT{};
     PFN_vkCmdWaitEvents vkCmdWaitEvents{};
     PFN_vkCreateBuffer vkCreateBuffer{};
     PFN_vkCreateBufferView vkCreateBufferView{};
@@ -275,6 +297,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkCreateSampler vkCreateSampler{};
     PFN_vkCreateSemaphore vkCreateSemaphore{};
     PFN_vkCreateShaderModule vkCreateShaderModule{};
+    PFN_vkCreateShadersEXT vkCreateShadersEXT{};
     PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR{};
     PFN_vkDestroyBuffer vkDestroyBuffer{};
     PFN_vkDestroyBufferView vkDestroyBufferView{};
@@ -294,6 +317,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkDestroyRenderPass vkDestroyRenderPass{};
     PFN_vkDestroySampler vkDestroySampler{};
     PFN_vkDestroySemaphore vkDestroySemaphore{};
+    PFN_vkDestroyShaderEXT vkDestroyShaderEXT{};
     PFN_vkDestroyShaderModule vkDestroyShaderModule{};
     PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR{};
     PFN_vkDeviceWaitIdle vkDeviceWaitIdle{};
@@ -301,13 +325,18 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkFreeCommandBuffers vkFreeCommandBuffers{};
     PFN_vkFreeDescriptorSets vkFreeDescriptorSets{};
     PFN_vkFreeMemory vkFreeMemory{};
+    PFN_vkGetBufferDeviceAddress vkGetBufferDeviceAddress{};
     PFN_vkGetBufferMemoryRequirements2 vkGetBufferMemoryRequirements2{};
+    PFN_vkGetDescriptorEXT vkGetDescriptorEXT{};
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT{};
+    PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT{};
     PFN_vkGetDeviceQueue vkGetDeviceQueue{};
     PFN_vkGetEventStatus vkGetEventStatus{};
     PFN_vkGetFenceStatus vkGetFenceStatus{};
     PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements{};
     PFN_vkGetPipelineCacheData vkGetPipelineCacheData{};
     PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR{};
+    PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT{};
 #ifdef _WIN32
     PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR{};
 #endif
@@ -325,6 +354,7 @@ struct DeviceDispatch : InstanceDispatch {
     PFN_vkUpdateDescriptorSetWithTemplate vkUpdateDescriptorSetWithTemplate{};
     PFN_vkUpdateDescriptorSets vkUpdateDescriptorSets{};
     PFN_vkWaitForFences vkWaitForFences{};
+    PFN_vkWaitForPresentKHR vkWaitForPresentKHR{};
     PFN_vkWaitSemaphores vkWaitSemaphores{};
 };
 
@@ -359,6 +389,7 @@ void Destroy(VkDevice, VkRenderPass, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSampler, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSwapchainKHR, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkSemaphore, const DeviceDispatch&) noexcept;
+void Destroy(VkDevice, VkShaderEXT, const DeviceDispatch&) noexcept;
 void Destroy(VkDevice, VkShaderModule, const DeviceDispatch&) noexcept;
 void Destroy(VkInstance, VkDebugUtilsMessengerEXT, const InstanceDispatch&) noexcept;
 void Destroy(VkInstance, VkDebugReportCallbackEXT, const InstanceDispatch&) noexcept;
@@ -585,6 +616,7 @@ using PipelineLayout = Handle<VkPipelineLayout, VkDevice, DeviceDispatch>;
 using QueryPool = Handle<VkQueryPool, VkDevice, DeviceDispatch>;
 using RenderPass = Handle<VkRenderPass, VkDevice, DeviceDispatch>;
 using Sampler = Handle<VkSampler, VkDevice, DeviceDispatch>;
+using ShaderEXT = Handle<VkShaderEXT, VkDevice, DeviceDispatch>;
 using SurfaceKHR = Handle<VkSurfaceKHR, VkInstance, InstanceDispatch>;
 
 using DescriptorSets = PoolAllocations<VkDescriptorSet, VkDescriptorPool>;
@@ -870,6 +902,11 @@ class SwapchainKHR : public Handle<VkSwapchainKHR, VkDevice, DeviceDispatch> {
 
 public:
     std::vector<VkImage> GetImages() const;
+
+    /// Waits until the present with the given identifier has been displayed (VK_KHR_present_wait)
+    VkResult WaitForPresentKHR(u64 present_id, u64 timeout) const noexcept {
+        return dld->vkWaitForPresentKHR(owner, handle, present_id, timeout);
+    }
 };
 
 class Event : public Handle<VkEvent, VkDevice, DeviceDispatch> {
@@ -994,6 +1031,8 @@ public:
 
     ShaderModule CreateShaderModule(const VkShaderModuleCreateInfo& ci) const;
 
+    ShaderEXT CreateShaderEXT(const VkShaderCreateInfoEXT& ci) const;
+
     Event CreateEvent() const;
 
     SwapchainKHR CreateSwapchainKHR(const VkSwapchainCreateInfoKHR& ci) const;
@@ -1021,6 +1060,46 @@ public:
         dld->vkUpdateDescriptorSetWithTemplate(handle, set, update_template, data);
     }
 
+    VkDeviceAddress GetBufferDeviceAddress(VkBuffer buffer) const noexcept {
+        const VkBufferDeviceAddressInfo info{
+            .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+            .pNext = nullptr,
+            .buffer = buffer,
+        };
+        return dld->vkGetBufferDeviceAddress(handle, &info);
+    }
+
+    VkDeviceSize GetDescriptorSetLayoutSizeEXT(VkDescriptorSetLayout layout) const noexcept {
+        VkDeviceSize size;
+        dld->vkGetDescriptorSetLayoutSizeEXT(handle, layout, &size);
+        return size;
+    }
+
+    VkDeviceSize GetDescriptorSetLayoutBindingOffsetEXT(VkDescriptorSetLayout layout,
+                                                        u32 binding) const noexcept {
+        VkDeviceSize offset;
+        dld->vkGetDescriptorSetLayoutBindingOffsetEXT(handle, layout, binding, &offset);
+        return offset;
+    }
+
+    void GetDescriptorEXT(const VkDescriptorGetInfoEXT& info, size_t size,
+                          void* descriptor) const noexcept {
+        dld->vkGetDescriptorEXT(handle, &info, size, descriptor);
+    }
+
+    /// Returns the memory types a host pointer can be imported as, zero when it can't be imported.
+    u32 GetMemoryHostPointerTypeBitsEXT(const void* host_pointer) const noexcept {
+        VkMemoryHostPointerPropertiesEXT host_properties{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT,
+            .pNext = nullptr,
+            .memoryTypeBits = 0,
+        };
+        const VkResult result = dld->vkGetMemoryHostPointerPropertiesEXT(
+            handle, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, host_pointer,
+            &host_properties);
+        return result == VK_SUCCESS ? host_properties.memoryTypeBits : 0;
+    }
+
     VkResult AcquireNextImageKHR(VkSwapchainKHR swapchain, u64 timeout, VkSemaphore semaphore,
                                  VkFence fence, u32* image_index) const noexcept {
         return dld->vkAcquireNextImageKHR(handle, swapchain, timeout, semaphore, fence,
@@ -1139,6 +1218,19 @@ public:
         dld->vkCmdPushDescriptorSetWithTemplateKHR(handle, update_template, layout, set, data);
     }
 
+    void BindDescriptorBuffersEXT(
+        Span<VkDescriptorBufferBindingInfoEXT> binding_infos) const noexcept {
+        dld->vkCmdBindDescriptorBuffersEXT(handle, binding_infos.size(), binding_infos.data());
+    }
+
+    void SetDescriptorBufferOffsetsEXT(VkPipelineBindPoint bind_point, VkPipelineLayout layout,
+                                       u32 first_set, Span<u32> buffer_indices,
+                                       Span<VkDeviceSize> offsets) const noexcept {
+        dld->vkCmdSetDescriptorBufferOffsetsEXT(handle, bind_point, layout, first_set,
+                                                offsets.size(), buffer_indices.data(),
+                                                offsets.data());
+    }
+
     void BindPipeline(VkPipelineBindPoint bind_point, VkPipeline pipeline) const noexcept {
         dld->vkCmdBindPipeline(handle, bind_point, pipeline);
     }
@@ -1456,6 +1548,84 @@ public:
         dld->vkCmdSetStencilTestEnableEXT(handle, enable ? VK_TRUE : VK_FALSE);
     }
 
+    void BindShadersEXT(vk::Span<VkShaderStageFlagBits> stages,
+                        const VkShaderEXT* shaders) const noexcept {
+        dld->vkCmdBindShadersEXT(handle, stages.size(), stages.data(), shaders);
+    }
+
+    void BeginRendering(const VkRenderingInfo& rendering_info) const noexcept {
+        dld->vkCmdBeginRendering(handle, &rendering_info);
+    }
+
+    void EndRendering() const noexcept {
+        dld->vkCmdEndRendering(handle);
+    }
+
+    void SetViewportWithCountEXT(Span<VkViewport> viewports) const noexcept {
+        dld->vkCmdSetViewportWithCountEXT(handle, viewports.size(), viewports.data());
+    }
+
+    void SetScissorWithCountEXT(Span<VkRect2D> scissors) const noexcept {
+        dld->vkCmdSetScissorWithCountEXT(handle, scissors.size(), scissors.data());
+    }
+
+    void SetPolygonModeEXT(VkPolygonMode polygon_mode) const noexcept {
+        dld->vkCmdSetPolygonModeEXT(handle, polygon_mode);
+    }
+
+    void SetRasterizationSamplesEXT(VkSampleCountFlagBits samples) const noexcept {
+        dld->vkCmdSetRasterizationSamplesEXT(handle, samples);
+    }
+
+    void SetSampleMaskEXT(VkSampleCountFlagBits samples, const VkSampleMask* mask) const noexcept {
+        dld->vkCmdSetSampleMaskEXT(handle, samples, mask);
+    }
+
+    void SetAlphaToCoverageEnableEXT(bool enable) const noexcept {
+        dld->vkCmdSetAlphaToCoverageEnableEXT(handle, enable ? VK_TRUE : VK_FALSE);
+    }
+
+    void SetAlphaToOneEnableEXT(bool enable) const noexcept {
+        dld->vkCmdSetAlphaToOneEnableEXT(handle, enable ? VK_TRUE : VK_FALSE);
+    }
+
+    void SetTessellationDomainOriginEXT(VkTessellationDomainOrigin origin) const noexcept {
+        dld->vkCmdSetTessellationDomainOriginEXT(handle, origin);
+    }
+
+    void SetProvokingVertexModeEXT(VkProvokingVertexModeEXT mode) const noexcept {
+        dld->vkCmdSetProvokingVertexModeEXT(handle, mode);
+    }
+
+    void SetLineRasterizationModeEXT(VkLineRasterizationModeEXT mode) const noexcept {
+        dld->vkCmdSetLineRasterizationModeEXT(handle, mode);
+    }
+
+    void SetLineStippleEnableEXT(bool enable) const noexcept {
+        dld->vkCmdSetLineStippleEnableEXT(handle, enable ? VK_TRUE : VK_FALSE);
+    }
+
+    void SetConservativeRasterizationModeEXT(
+        VkConservativeRasterizationModeEXT mode) const noexcept {
+        dld->vkCmdSetConservativeRasterizationModeEXT(handle, mode);
+    }
+
+    void SetExtraPrimitiveOverestimationSizeEXT(float size) const noexcept {
+        dld->vkCmdSetExtraPrimitiveOverestimationSizeEXT(handle, size);
+    }
+
+    void SetDepthClipNegativeOneToOneEXT(bool enable) const noexcept {
+        dld->vkCmdSetDepthClipNegativeOneToOneEXT(handle, enable ? VK_TRUE : VK_FALSE);
+    }
+
+    void SetViewportSwizzleNV(u32 first, Span<VkViewportSwizzleNV> swizzles) const noexcept {
+        dld->vkCmdSetViewportSwizzleNV(handle, first, swizzles.size(), swizzles.data());
+    }
+
+    void SetRasterizationStreamEXT(u32 stream) const noexcept {
+        dld->vkCmdSetRasterizationStreamEXT(handle, stream);
+    }
+
     void SetVertexInputEXT(
         vk::Span<VkVertexInputBindingDescription2EXT> bindings,
         vk::Span<VkVertexInputAttributeDescription2EXT> attributes) const noexcept {
@@ -65,6 +65,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            "to let big texture mods fit in emulated RAM.\nEnabling it will increase memory "
            "use. It is not recommended to enable unless a specific game with a texture mod needs "
            "it."));
+    INSERT(Settings, use_huge_pages, tr("Use Huge Pages for Emulated RAM"),
+           tr("Backs the emulated RAM with transparent huge pages where the host allows it, "
+              "reducing TLB misses of CPU emulation.\nOnly available on Linux, and requires "
+              "shmem_enabled in /sys/kernel/mm/transparent_hugepage to not be \"never\".\nThis "
+              "takes effect after yuzu is restarted."));
     INSERT(Settings, use_speed_limit, QStringLiteral(), QStringLiteral());
     INSERT(Settings, speed_limit, tr("Limit Speed Percent"),
            tr("Controls the game's maximum rendering speed, but it’s up to each game if it runs "
@@ -183,6 +188,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
     // Renderer (Advanced Graphics)
     INSERT(Settings, async_presentation, tr("Enable asynchronous presentation (Vulkan only)"),
            tr("Slightly improves performance by moving presentation to a separate CPU thread."));
+    INSERT(Settings, low_latency_presentation, tr("Low latency frame pacing (Vulkan only)"),
+           tr("Limits how many frames the emulator may render ahead of the display, adapting "
+              "the limit to avoid stutter.\nReduces input latency. Uses VK_KHR_present_wait when "
+              "available."));
     INSERT(
         Settings, renderer_force_max_clock, tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
@@ -212,6 +221,42 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
         tr("Enable compute pipelines, required by some games.\nThis setting only exists for Intel "
            "proprietary drivers, and may crash if enabled.\nCompute pipelines are always enabled "
            "on all other drivers."));
+    INSERT(Settings, use_vulkan_graphics_pipeline_library,
+           tr("Use Vulkan graphics pipeline libraries (Experimental)"),
+           tr("Links new pipelines from separately compiled parts with "
+              "VK_EXT_graphics_pipeline_library when supported, then replaces them with fully "
+              "optimized pipelines in the background.\nReduces stutter when new shaders are "
+              "first used."));
+    INSERT(Settings, use_vulkan_shader_objects, tr("Use Vulkan shader objects (Experimental)"),
+           tr("Draws with VK_EXT_shader_object instead of graphics pipelines when supported.\nThis "
+              "removes most pipeline compilation stutter at the cost of some GPU performance."));
+    INSERT(Settings, use_vulkan_dynamic_rendering,
+           tr("Use Vulkan dynamic rendering (Experimental)"),
+           tr("Binds render targets with VK_KHR_dynamic_rendering instead of render pass and "
+              "framebuffer objects when supported.\nConsecutive draws to the same render targets "
+              "are kept in a single rendering pass."));
+    INSERT(Settings, use_vulkan_descriptor_buffer,
+           tr("Use Vulkan descriptor buffers (Experimental)"),
+           tr("Writes draw descriptors directly into GPU memory with VK_EXT_descriptor_buffer "
+              "instead of allocating and updating descriptor sets.\nReduces CPU usage in games "
+              "with many draws per frame."));
+    INSERT(Settings, use_vulkan_host_memory_import,
+           tr("Share guest memory with the GPU (Experimental)"),
+           tr("Imports emulated memory directly into GPU buffers with "
+              "VK_EXT_external_memory_host on integrated and software GPUs.\nRemoves most buffer "
+              "upload and download copies on devices that share memory with the CPU."));
+    INSERT(Settings, use_vulkan_async_compute, tr("Use asynchronous compute queue (Experimental)"),
+           tr("Decodes newly loaded ASTC textures on a dedicated compute queue when the GPU "
+              "has one.\nDecoding overlaps rendering instead of stalling the emulated GPU."));
+    INSERT(Settings, use_parallel_command_recording,
+           tr("Record Vulkan commands on multiple threads (Experimental)"),
+           tr("Splits the commands of each submission into several command buffers that are "
+              "recorded in parallel.\nHelps draw-heavy games on CPUs with many cores."));
+    INSERT(Settings, use_gl_bindless_textures,
+           tr("Use bindless textures (OpenGL GLSL only, Experimental)"),
+           tr("Shaders read texture handles from memory with GL_ARB_bindless_texture instead of "
+              "binding textures and samplers on every draw.\nReduces CPU usage in games with "
+              "many draws per frame."));
     INSERT(
         Settings, use_reactive_flushing, tr("Enable Reactive Flushing"),
         tr("Uses reactive flushing instead of predictive flushing, allowing more accurate memory "
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -34,6 +35,8 @@
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
+#include "video_core/gpu.h"
+#include "video_core/gpu_trace_player.h"
 #include "video_core/renderer_base.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_gl.h"
@@ -78,10 +81,59 @@ static void PrintHelp(const char* argv0) {
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-t, --gpu-trace       Replay a GPU trace and report its frame times\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-v, --version         Output version information and exit\n";
 }
 
+static int ReplayGpuTrace(Core::System& system, EmuWindow_SDL2& emu_window,
+                          const std::string& trace_path) {
+    // The replay is not an application, there is nothing to capture
+    Settings::values.gpu_trace_capture = false;
+
+    const Core::SystemResultStatus setup_result{system.SetupForGpuReplay(emu_window)};
+    if (setup_result != Core::SystemResultStatus::Success) {
+        LOG_CRITICAL(Frontend, "Failed to initialize the GPU for replay (Error {})",
+                     static_cast<u32>(setup_result));
+        return -1;
+    }
+    system.GPU().Start();
+
+    std::vector<std::chrono::nanoseconds> frame_times;
+    {
+        Tegra::GpuTrace::Player player{system, trace_path};
+        if (!player.IsOpen()) {
+            system.ShutdownMainProcess();
+            return -1;
+        }
+        frame_times = player.Run();
+    }
+    system.ShutdownMainProcess();
+
+    if (frame_times.empty()) {
+        std::cout << "The GPU trace presented no frames\n";
+        return 0;
+    }
+    const auto to_ms{[](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    }};
+    std::chrono::nanoseconds total{};
+    for (const std::chrono::nanoseconds frame_time : frame_times) {
+        total += frame_time;
+    }
+    std::ranges::sort(frame_times);
+    const size_t p99_index{std::min(frame_times.size() - 1, frame_times.size() * 99 / 100)};
+    std::cout << fmt::format("Frames: {}\n"
+                             "Mean: {:.3f} ms\n"
+                             "Min: {:.3f} ms\n"
+                             "Max: {:.3f} ms\n"
+                             "P99: {:.3f} ms\n",
+                             frame_times.size(), to_ms(total) / frame_times.size(),
+                             to_ms(frame_times.front()), to_ms(frame_times.back()),
+                             to_ms(frame_times[p99_index]));
+    return 0;
+}
+
 static void PrintVersion() {
     std::cout << "yuzu " << Common::g_scm_branch << " " << Common::g_scm_desc << std::endl;
 }
@@ -208,6 +260,7 @@ int main(int argc, char** argv) {
     }
 #endif
     std::string filepath;
+    std::string gpu_trace_path;
     std::optional<std::string> config_path;
     std::string program_args;
     std::optional<int> selected_user;
@@ -227,6 +280,7 @@ int main(int argc, char** argv) {
         {"game", required_argument, 0, 'g'},
         {"multiplayer", required_argument, 0, 'm'},
         {"program", optional_argument, 0, 'p'},
+        {"gpu-trace", required_argument, 0, 't'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -234,7 +288,7 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:fhvp::c:u:t:", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
             case 'c':
@@ -289,6 +343,9 @@ int main(int argc, char** argv) {
                 program_args = argv[optind];
                 ++optind;
                 break;
+            case 't':
+                gpu_trace_path = optarg;
+                break;
             case 'u':
                 selected_user = atoi(optarg);
                 break;
@@ -333,7 +390,7 @@ int main(int argc, char** argv) {
 
     Common::ConfigureNvidiaEnvironmentFlags();
 
-    if (filepath.empty()) {
+    if (filepath.empty() && gpu_trace_path.empty()) {
         LOG_CRITICAL(Frontend, "Failed to load ROM: No ROM specified");
         return -1;
     }
@@ -364,6 +421,10 @@ int main(int argc, char** argv) {
     system.CoreTiming().SetTimerResolutionNs(Common::Windows::GetCurrentTimerResolution());
 #endif
 
+    if (!gpu_trace_path.empty()) {
+        return ReplayGpuTrace(system, *emu_window, gpu_trace_path);
+    }
+
     system.SetContentProvider(std::make_unique<FileSys::ContentProviderUnion>());
     system.SetFilesystem(std::make_shared<FileSys::RealVfsFilesystem>());
     system.GetFileSystemController().CreateFactories(*system.GetFilesystem());